@@ -0,0 +1,420 @@
+// parser_bench.cpp
+// Feed parser and serializer throughput over the recorded corpus in
+// bench/corpus and the items in news_feed.json. Per-item benchmarks report
+// ns/item and allocs/item (heap allocations counted by the operator new below),
+// the ones that consume feed text also MB/s.
+// Build: g++ -std=c++17 -O2 -pthread bench/parser_bench.cpp -lbenchmark -lcurl -lssl -lcrypto -o parser_bench
+// Run from the repository root: ./parser_bench [--benchmark_filter=...]
+//   CORPUS_DIR and NEWS_FEED_JSON override the input locations
+
+#define REALSSA_NO_MAIN
+#include "../realssa_news_linux.cpp"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+
+// Every heap allocation in the process, for the allocs/item counters
+static atomic<size_t> allocationCount{ 0 };
+
+// Kept out of line: inlined, GCC sees new'd pointers reach free()
+__attribute__((noinline)) void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* block = malloc(size ? size : 1)) return block;
+    throw bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* block) noexcept {
+    free(block);
+}
+
+__attribute__((noinline)) void operator delete(void* block, size_t) noexcept {
+    free(block);
+}
+
+namespace {
+
+struct CorpusFile {
+    string name;
+    string body;
+};
+
+string readFile(const string& path) {
+    ifstream in(path, ios::binary);
+    stringstream body;
+    body << in.rdbuf();
+    return body.str();
+}
+
+vector<CorpusFile> loadCorpus(const string& dir) {
+    vector<CorpusFile> corpus;
+    for (const auto& entry : filesystem::directory_iterator(dir)) {
+        if (!entry.is_regular_file() || entry.path().extension() == ".md") continue;
+        corpus.push_back({ entry.path().filename().string(), readFile(entry.path().string()) });
+    }
+    sort(corpus.begin(), corpus.end(), [](const CorpusFile& a, const CorpusFile& b) { return a.name < b.name; });
+    return corpus;
+}
+
+// The flat records of news_feed.json as NewsItems. Only what that file
+// uses is read: an array of objects whose values are strings, or true
+// where a field is missing, which becomes an empty string.
+class NewsFeedReader {
+public:
+    static vector<NewsItem> read(string_view json) {
+        vector<NewsItem> items;
+        size_t pos = 0;
+        if (!expect(json, pos, '[')) return items;
+        while (expect(json, pos, '{')) {
+            NewsItem item;
+            while (pos < json.size() && json[pos] != '}') {
+                string key = readString(json, pos);
+                if (!expect(json, pos, ':')) return items;
+                string value = readValue(json, pos);
+                if (key == "title") item.title = move(value);
+                else if (key == "link") item.link = move(value);
+                else if (key == "description") item.description = move(value);
+                else if (key == "pubDate") item.pubDate = move(value);
+                else if (key == "source") item.source = move(value);
+                else if (key == "category") item.category = move(value);
+                else if (key == "country") item.country = move(value);
+                else if (key == "imageUrl") item.imageUrl = move(value);
+                expect(json, pos, ',');
+                skipSpace(json, pos);
+            }
+            pos++;
+            item.published = FeedDate::parse(item.pubDate);
+            items.push_back(move(item));
+            expect(json, pos, ',');
+        }
+        return items;
+    }
+
+private:
+    static void skipSpace(string_view json, size_t& pos) {
+        while (pos < json.size() && isspace((unsigned char)json[pos])) pos++;
+    }
+
+    static bool expect(string_view json, size_t& pos, char c) {
+        skipSpace(json, pos);
+        if (pos >= json.size() || json[pos] != c) return false;
+        pos++;
+        skipSpace(json, pos);
+        return true;
+    }
+
+    static string readValue(string_view json, size_t& pos) {
+        if (pos < json.size() && json[pos] == '"') return readString(json, pos);
+        while (pos < json.size() && json[pos] != ',' && json[pos] != '}') pos++;
+        return "";
+    }
+
+    static string readString(string_view json, size_t& pos) {
+        string text;
+        if (pos >= json.size() || json[pos] != '"') return text;
+        pos++;
+        while (pos < json.size() && json[pos] != '"') {
+            char c = json[pos++];
+            if (c != '\\' || pos >= json.size()) {
+                text += c;
+                continue;
+            }
+            char escape = json[pos++];
+            switch (escape) {
+            case 'n': text += '\n'; break;
+            case 'r': text += '\r'; break;
+            case 't': text += '\t'; break;
+            case 'b': text += '\b'; break;
+            case 'f': text += '\f'; break;
+            case 'u': {
+                uint32_t codepoint = 0;
+                from_chars(json.data() + pos, json.data() + min(pos + 4, json.size()), codepoint, 16);
+                pos += 4;
+                if (codepoint >= 0xD800 && codepoint < 0xDC00 && json.substr(pos, 2) == "\\u") {
+                    uint32_t low = 0;
+                    from_chars(json.data() + pos + 2, json.data() + min(pos + 6, json.size()), low, 16);
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                    pos += 6;
+                }
+                char encoded[4];
+                text.append(encoded, TextEncoding::encodeUTF8(codepoint, encoded));
+                break;
+            }
+            default: text += escape; break;
+            }
+        }
+        pos++;
+        return text;
+    }
+};
+
+// Items per second, their inverse as ns/item, and heap allocations per item
+// since `allocationsBefore`
+void reportPerItem(benchmark::State& state, size_t items, size_t allocationsBefore) {
+    size_t allocations = allocationCount.load(memory_order_relaxed) - allocationsBefore;
+    state.counters["items"] = benchmark::Counter((double)items, benchmark::Counter::kIsRate);
+    state.counters["ns/item"] = benchmark::Counter((double)items,
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["allocs/item"] = items ? (double)allocations / (double)items : 0.0;
+}
+
+// Raw content of every <name ...>...</name> element, e.g. the HTML-heavy
+// descriptions and Atom content that dominate cleanText time
+vector<string_view> collectFields(string_view doc, string_view name) {
+    vector<string_view> fields;
+    string open = "<" + string(name);
+    string close = "</" + string(name) + ">";
+    size_t pos = 0;
+    while ((pos = doc.find(open, pos)) != string_view::npos) {
+        size_t after = pos + open.size();
+        if (after >= doc.size() || (doc[after] != '>' && doc[after] != ' ')) {
+            pos = after;
+            continue;
+        }
+        size_t start = doc.find('>', after);
+        size_t end = doc.find(close, start);
+        if (start == string_view::npos || end == string_view::npos) break;
+        fields.push_back(doc.substr(start + 1, end - start - 1));
+        pos = end + close.size();
+    }
+    return fields;
+}
+
+// Whole-document scan: every item's fields located, nothing cleaned
+void BM_Tokenize(benchmark::State& state, const CorpusFile* file) {
+    size_t items = 0;
+    for (auto _ : state) {
+        FeedTokenizer::forEachItem(file->body, [&](const FeedTokenizer::RawItem& raw) {
+            benchmark::DoNotOptimize(raw.title.data());
+            items++;
+            return true;
+            });
+    }
+    state.SetBytesProcessed(state.iterations() * file->body.size());
+    state.counters["items"] = benchmark::Counter((double)items, benchmark::Counter::kIsRate);
+}
+
+// The per-field lookup over each item's markup: title, link, description
+// and pubDate located, nothing copied
+void BM_ExtractTag(benchmark::State& state, const CorpusFile* file) {
+    vector<string_view> elements = collectFields(file->body, "item");
+    vector<string_view> entries = collectFields(file->body, "entry");
+    elements.insert(elements.end(), entries.begin(), entries.end());
+    if (elements.empty()) {
+        state.SkipWithError("no items");
+        return;
+    }
+
+    size_t bytes = 0;
+    for (string_view element : elements) bytes += element.size();
+
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        for (string_view element : elements) {
+            for (const char* tag : { "title", "link", "description", "pubDate" }) {
+                string_view value = XMLParser::extractTag(element, tag);
+                benchmark::DoNotOptimize(value.data());
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+    reportPerItem(state, state.iterations() * elements.size(), allocationsBefore);
+}
+
+// Image selection over every item the tokenizer finds
+void BM_ExtractImageURL(benchmark::State& state, const CorpusFile* file) {
+    vector<FeedTokenizer::RawItem> raws;
+    FeedTokenizer::forEachItem(file->body, [&](const FeedTokenizer::RawItem& raw) {
+        raws.push_back(raw);
+        return true;
+        });
+    if (raws.empty()) {
+        state.SkipWithError("no items");
+        return;
+    }
+
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        for (const auto& raw : raws) {
+            string url = XMLParser::extractImageURL(raw);
+            benchmark::DoNotOptimize(url.data());
+        }
+    }
+    reportPerItem(state, state.iterations() * raws.size(), allocationsBefore);
+}
+
+// What a refresh does per feed: the first 30 items, cleaned and stored
+void BM_ParseRSS(benchmark::State& state, const CorpusFile* file) {
+    size_t items = 0;
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        FeedItems parsed = XMLParser::parseRSS(file->body, "Bench", "General News", "Global");
+        items += parsed.size();
+        benchmark::DoNotOptimize(parsed.data());
+    }
+    reportPerItem(state, items, allocationsBefore);
+}
+
+// Every item in the document, which is where intra-document parallelism
+// shows; a pool of hardware_concurrency threads, or none for the serial run
+void BM_ParseDocument(benchmark::State& state, const CorpusFile* file, bool parallel) {
+    static WorkerPool pool(max(2u, thread::hardware_concurrency()));
+    size_t items = 0;
+    for (auto _ : state) {
+        FeedItems parsed = XMLParser::parseRSS(file->body, "Bench", "General News", "Global", nullptr,
+            parallel ? &pool : nullptr, SIZE_MAX);
+        items += parsed.size();
+        benchmark::DoNotOptimize(parsed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * file->body.size());
+    state.counters["items"] = benchmark::Counter((double)items, benchmark::Counter::kIsRate);
+}
+
+void BM_CleanText(benchmark::State& state, const CorpusFile* file) {
+    vector<string_view> fields;
+    for (const char* name : { "title", "description", "content", "content:encoded" }) {
+        vector<string_view> found = collectFields(file->body, name);
+        fields.insert(fields.end(), found.begin(), found.end());
+    }
+
+    size_t bytes = 0;
+    for (string_view field : fields) bytes += field.size();
+    if (bytes == 0) {
+        state.SkipWithError("no text fields");
+        return;
+    }
+
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        for (string_view field : fields) {
+            string text = XMLParser::cleanText(field);
+            benchmark::DoNotOptimize(text.data());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+    reportPerItem(state, state.iterations() * fields.size(), allocationsBefore);
+}
+
+// The ingest check every fetched body goes through
+void BM_ValidateUTF8(benchmark::State& state, const CorpusFile* file) {
+    for (auto _ : state) {
+        size_t valid = TextEncoding::validPrefix(file->body);
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetBytesProcessed(state.iterations() * file->body.size());
+}
+
+// The same bytes read as windows-1252, as for a feed that fails validation
+void BM_FromWindows1252(benchmark::State& state, const CorpusFile* file) {
+    for (auto _ : state) {
+        string text = TextEncoding::fromWindows1252(file->body);
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(state.iterations() * file->body.size());
+}
+
+// Every timestamp in the corpus, RFC 822 and ISO 8601 alike
+void BM_ParseDate(benchmark::State& state, const vector<CorpusFile>* corpus) {
+    vector<string> dates;
+    for (const auto& file : *corpus) {
+        for (const char* name : { "pubDate", "dc:date", "updated", "published" }) {
+            for (string_view field : collectFields(file.body, name)) dates.push_back(XMLParser::cleanText(field));
+        }
+    }
+    if (dates.empty()) {
+        state.SkipWithError("no dates");
+        return;
+    }
+
+    size_t parsed = 0;
+    for (auto _ : state) {
+        for (const string& date : dates) {
+            int64_t epoch = FeedDate::parse(date);
+            benchmark::DoNotOptimize(epoch);
+            parsed += epoch != 0;
+        }
+    }
+    state.counters["dates"] = benchmark::Counter((double)(state.iterations() * dates.size()), benchmark::Counter::kIsRate);
+    state.counters["parsed"] = (double)parsed / (double)(state.iterations() * dates.size());
+}
+
+// One item's JSON object, as JSON::object builds it. MB/s counts the
+// JSON written.
+void BM_ItemJSON(benchmark::State& state, const vector<NewsItem>* items) {
+    size_t bytes = 0;
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        for (const auto& item : *items) {
+            string json = item.toJSON();
+            bytes += json.size();
+            benchmark::DoNotOptimize(json.data());
+        }
+    }
+    state.SetBytesProcessed(bytes);
+    reportPerItem(state, state.iterations() * items->size(), allocationsBefore);
+}
+
+// The whole /news-feed body, as getJSON serializes a published snapshot, with
+// the items grouped into one segment per source like the aggregator's feeds
+void BM_SnapshotJSON(benchmark::State& state, const vector<NewsItem>* items) {
+    map<string, FeedItems> bySource;
+    for (const auto& item : *items) bySource[item.source].push_back(make_shared<const NewsItem>(item));
+
+    FeedSnapshot snapshot;
+    for (auto& [source, segment] : bySource) {
+        snapshot.itemCount += segment.size();
+        snapshot.segments.push_back(make_shared<const FeedItems>(move(segment)));
+    }
+
+    size_t bytes = 0;
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+    for (auto _ : state) {
+        string json = snapshot.toJSON();
+        bytes += json.size();
+        benchmark::DoNotOptimize(json.data());
+    }
+    state.SetBytesProcessed(bytes);
+    reportPerItem(state, state.iterations() * snapshot.itemCount, allocationsBefore);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* dir = getenv("CORPUS_DIR");
+    static vector<CorpusFile> corpus = loadCorpus(dir ? dir : "bench/corpus");
+    if (corpus.empty()) {
+        cerr << "No corpus files found" << endl;
+        return 1;
+    }
+
+    const char* newsFeedPath = getenv("NEWS_FEED_JSON");
+    static vector<NewsItem> newsFeed = NewsFeedReader::read(readFile(newsFeedPath ? newsFeedPath : "news_feed.json"));
+
+    for (const auto& file : corpus) {
+        benchmark::RegisterBenchmark(("BM_Tokenize/" + file.name).c_str(), BM_Tokenize, &file);
+        benchmark::RegisterBenchmark(("BM_ExtractTag/" + file.name).c_str(), BM_ExtractTag, &file);
+        benchmark::RegisterBenchmark(("BM_ExtractImageURL/" + file.name).c_str(), BM_ExtractImageURL, &file);
+        benchmark::RegisterBenchmark(("BM_ParseRSS/" + file.name).c_str(), BM_ParseRSS, &file);
+        benchmark::RegisterBenchmark(("BM_CleanText/" + file.name).c_str(), BM_CleanText, &file);
+        benchmark::RegisterBenchmark(("BM_ValidateUTF8/" + file.name).c_str(), BM_ValidateUTF8, &file);
+        benchmark::RegisterBenchmark(("BM_FromWindows1252/" + file.name).c_str(), BM_FromWindows1252, &file);
+        benchmark::RegisterBenchmark(("BM_ParseDocument/serial/" + file.name).c_str(), BM_ParseDocument, &file, false)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("BM_ParseDocument/parallel/" + file.name).c_str(), BM_ParseDocument, &file, true)
+            ->UseRealTime();
+    }
+
+    benchmark::RegisterBenchmark("BM_ParseDate", BM_ParseDate, &corpus);
+    if (newsFeed.empty()) {
+        cerr << "news_feed.json not found or empty, skipping the JSON benchmarks" << endl;
+    }
+    else {
+        benchmark::RegisterBenchmark("BM_ItemJSON/news_feed.json", BM_ItemJSON, &newsFeed);
+        benchmark::RegisterBenchmark("BM_SnapshotJSON/news_feed.json", BM_SnapshotJSON, &newsFeed);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -1,18 +1,43 @@
 // realssa_news_linux.cpp
 // Cross-platform RSS News Feed Service for Railway
-// Build: g++ -std=c++17 -pthread realssa_news_linux.cpp -lcurl -o realssa_news
+// Build: g++ -std=c++17 -pthread -rdynamic realssa_news_linux.cpp -lcurl -o realssa_news
+// (-rdynamic lets /debug/profile name the service's own functions; add
+// -DREALSSA_ALLOC_STATS to count heap allocations for /metrics)
 
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <array>
+#include <cstring>
+#include <unordered_set>
+#include <random>
 #include <chrono>
 #include <sstream>
+#include <fstream>
 #include <algorithm>
+#include <charconv>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 #include <curl/curl.h>
 
 // Single-header HTTP server library (embedded)
@@ -45,8 +70,35 @@ public:
         return result;
     }
 
+    // A string field, or with number set, a value written unquoted as is
+    struct Field {
+        string_view key;
+        string_view value;
+        bool number = false;
+    };
+
+    // Fixed-order object from views, so callers need not build a map first
+    static string object(initializer_list<Field> fields) {
+        string result = "{";
+        size_t i = 0;
+        for (const Field& field : fields) {
+            result += "\"";
+            result += field.key;
+            if (field.number) {
+                result += "\":";
+                result += field.value;
+            }
+            else {
+                result += "\":\"" + escape(field.value) + "\"";
+            }
+            if (++i < fields.size()) result += ",";
+        }
+        result += "}";
+        return result;
+    }
+
 private:
-    static string escape(const string& str) {
+    static string escape(string_view str) {
         string result;
         for (char c : str) {
             switch (c) {
@@ -55,14 +107,555 @@ private:
             case '\n': result += "\\n"; break;
             case '\r': result += "\\r"; break;
             case '\t': result += "\\t"; break;
-            default: result += c;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char code[7];
+                    snprintf(code, sizeof(code), "\\u%04x", (unsigned char)c);
+                    result += code;
+                }
+                else {
+                    result += c;
+                }
             }
         }
         return result;
     }
 };
 
-// HTTP fetcher using libcurl
+// Span recorder for the refresh pipeline, exported as Chrome Trace Event JSON
+// (ui.perfetto.dev, chrome://tracing). Each thread appends to its own ring of
+// the last kEvents spans without taking a lock; the registry lock is only
+// taken the first time a thread records and when exporting. Event fields are
+// relaxed atomics, and the exporter drops any slot the writer may have lapped
+// while it was copying.
+class Trace {
+public:
+    static constexpr size_t kEvents = 8192;   // per thread
+
+    // Times the enclosing scope as one complete event
+    class Span {
+    public:
+        explicit Span(const char* name, const char* argName = nullptr, int64_t arg = 0)
+            : name(name), argName(argName), arg(arg), start(now()) {}
+
+        ~Span() {
+            record(name, argName, arg, start, now() - start, false);
+        }
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        const char* name;
+        const char* argName;
+        int64_t arg;
+        int64_t start;
+    };
+
+    // A span measured elsewhere that may overlap others on this thread (a
+    // transfer, timed by curl), drawn on its own async track
+    static void async(const char* name, const char* argName, int64_t arg, int64_t start, int64_t duration) {
+        record(name, argName, arg, start, duration, true);
+    }
+
+    // Also names the OS thread (first 15 bytes), which top and the profiler show
+    static void nameThread(const char* name) {
+        local().threadName.store(name, memory_order_relaxed);
+        char osName[16];
+        snprintf(osName, sizeof(osName), "%s", name);
+        pthread_setname_np(pthread_self(), osName);
+    }
+
+    // Microseconds since the process started tracing
+    static int64_t now() {
+        static const auto epoch = chrono::steady_clock::now();
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - epoch).count();
+    }
+
+    // Every recorded span that ends after the start of the last `refreshes`
+    // spans named "refresh", or everything if there are not that many
+    static string toJSON(size_t refreshes) {
+        struct Copy {
+            const char* name;
+            const char* argName;
+            int64_t arg, start, duration;
+            bool async;
+            uint32_t tid;
+        };
+        vector<Copy> events;
+        vector<pair<uint32_t, const char*>> threads;
+        {
+            lock_guard<mutex> lock(registryMutex());
+            for (const auto& buffer : registry()) {
+                threads.push_back({ buffer->tid, buffer->threadName.load(memory_order_relaxed) });
+                uint64_t head = buffer->head.load(memory_order_acquire);
+                size_t first = events.size();
+                for (uint64_t i = head > kEvents ? head - kEvents : 0; i < head; i++) {
+                    const Event& e = buffer->events[i % kEvents];
+                    events.push_back({ e.name.load(memory_order_relaxed), e.argName.load(memory_order_relaxed),
+                        e.arg.load(memory_order_relaxed), e.start.load(memory_order_relaxed),
+                        e.duration.load(memory_order_relaxed), e.async.load(memory_order_relaxed), buffer->tid });
+                }
+                // Slots overwritten while copying may mix two events
+                uint64_t after = buffer->head.load(memory_order_acquire);
+                uint64_t lapped = after > kEvents ? after - kEvents : 0;
+                uint64_t copiedFrom = head > kEvents ? head - kEvents : 0;
+                if (lapped > copiedFrom) {
+                    size_t drop = (size_t)min<uint64_t>(lapped - copiedFrom, events.size() - first);
+                    events.erase(events.begin() + first, events.begin() + first + drop);
+                }
+            }
+        }
+
+        vector<int64_t> refreshStarts;
+        for (const Copy& e : events) {
+            if (strcmp(e.name, "refresh") == 0) refreshStarts.push_back(e.start);
+        }
+        sort(refreshStarts.begin(), refreshStarts.end());
+        int64_t from = refreshes > 0 && refreshStarts.size() >= refreshes
+            ? refreshStarts[refreshStarts.size() - refreshes] : INT64_MIN;
+
+        string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        auto append = [&](const string& event) {
+            if (!first) json += ",";
+            json += event;
+            first = false;
+        };
+
+        for (const auto& [tid, name] : threads) {
+            string threadName = name ? name : "thread " + to_string(tid);
+            append("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" + to_string(tid) +
+                ",\"args\":{\"name\":\"" + threadName + "\"}}");
+        }
+
+        for (const Copy& e : events) {
+            if (e.start + e.duration < from) continue;
+            string common = string("\"name\":\"") + e.name + "\",\"cat\":\"refresh\",\"pid\":1,\"tid\":" + to_string(e.tid);
+            string args = e.argName ? string(",\"args\":{\"") + e.argName + "\":" + to_string(e.arg) + "}" : "";
+            if (e.async) {
+                string id = ",\"id\":\"" + to_string(e.start) + "-" + to_string(e.arg) + "\"";
+                append("{" + common + ",\"ph\":\"b\",\"ts\":" + to_string(e.start) + id + args + "}");
+                append("{" + common + ",\"ph\":\"e\",\"ts\":" + to_string(e.start + e.duration) + id + "}");
+            }
+            else {
+                append("{" + common + ",\"ph\":\"X\",\"ts\":" + to_string(e.start) +
+                    ",\"dur\":" + to_string(e.duration) + args + "}");
+            }
+        }
+        return json + "]}";
+    }
+
+private:
+    struct Event {
+        atomic<const char*> name{ nullptr };
+        atomic<const char*> argName{ nullptr };
+        atomic<int64_t> arg{ 0 };
+        atomic<int64_t> start{ 0 };
+        atomic<int64_t> duration{ 0 };
+        atomic<bool> async{ false };
+    };
+
+    struct Buffer {
+        array<Event, kEvents> events;
+        atomic<uint64_t> head{ 0 };   // events ever recorded; only the owning thread writes
+        atomic<const char*> threadName{ nullptr };
+        uint32_t tid = 0;
+    };
+
+    static mutex& registryMutex() {
+        static mutex m;
+        return m;
+    }
+
+    // Buffers outlive their threads, so spans of exited threads still export
+    static vector<shared_ptr<Buffer>>& registry() {
+        static vector<shared_ptr<Buffer>> buffers;
+        return buffers;
+    }
+
+    static Buffer& local() {
+        thread_local shared_ptr<Buffer> buffer = []() {
+            auto created = make_shared<Buffer>();
+            lock_guard<mutex> lock(registryMutex());
+            created->tid = (uint32_t)registry().size() + 1;
+            registry().push_back(created);
+            return created;
+        }();
+        return *buffer;
+    }
+
+    static void record(const char* name, const char* argName, int64_t arg, int64_t start, int64_t duration, bool async) {
+        Buffer& buffer = local();
+        uint64_t index = buffer.head.load(memory_order_relaxed);
+        Event& e = buffer.events[index % kEvents];
+        e.name.store(name, memory_order_relaxed);
+        e.argName.store(argName, memory_order_relaxed);
+        e.arg.store(arg, memory_order_relaxed);
+        e.start.store(start, memory_order_relaxed);
+        e.duration.store(duration, memory_order_relaxed);
+        e.async.store(async, memory_order_relaxed);
+        buffer.head.store(index + 1, memory_order_release);
+    }
+};
+
+// Sampling CPU profiler behind /debug/profile. ITIMER_PROF ticks with the
+// process's CPU time and the kernel delivers each SIGPROF to a thread that
+// was running, so every busy thread is sampled in proportion to the CPU it
+// uses and idle ones never show up. The handler only copies a backtrace into
+// a buffer allocated before the timer starts; symbols are resolved once it
+// stops. Nothing is installed outside a profile.
+class Profiler {
+public:
+    static constexpr int kMaxDepth = 48;
+    static constexpr size_t kMaxSamples = 32768;
+    static constexpr int kDefaultHz = 99;
+
+    struct Result {
+        string folded;      // "thread;outer;...;leaf count" lines, for flamegraph.pl or speedscope
+        size_t samples = 0;
+        size_t dropped = 0; // ticks that found the buffer full
+        bool busy = false;  // another profile was running
+        string error;       // why profile() returned false
+    };
+
+    // Profiles the whole process for `seconds`, blocking the caller. Returns
+    // false without profiling if another profile is running or the timer
+    // can't be armed.
+    static bool profile(int seconds, int hz, Result& result) {
+        bool idle = false;
+        if (!running().compare_exchange_strong(idle, true)) {
+            result.busy = true;
+            result.error = "A profile is already running";
+            return false;
+        }
+
+        size_t capacity = min(kMaxSamples, (size_t)seconds * hz * max(1u, thread::hardware_concurrency()));
+        vector<Sample> buffer(capacity);
+
+        // backtrace() loads the unwinder on first use, which must not
+        // happen inside the handler
+        void* warmup[1];
+        backtrace(warmup, 1);
+
+        next().store(0);
+        samples().store(buffer.data());
+        limit().store(capacity);
+
+        struct sigaction action = {}, previous = {};
+        action.sa_handler = onSignal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGPROF, &action, &previous);
+
+        // tv_usec must stay below a second
+        struct itimerval timer = {};
+        timer.it_interval.tv_sec = 1 / hz;
+        timer.it_interval.tv_usec = (1000000 / hz) % 1000000;
+        timer.it_value = timer.it_interval;
+        if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+            result.error = string("setitimer: ") + strerror(errno);
+            stop(previous);
+            running().store(false);
+            return false;
+        }
+
+        this_thread::sleep_for(chrono::seconds(seconds));
+        stop(previous);
+
+        size_t taken = min<size_t>(next().load(), capacity);
+        result.samples = taken;
+        result.dropped = next().load() - taken;
+        running().store(false);
+        result.folded = fold(buffer, taken);
+        return true;
+    }
+
+private:
+    struct Sample {
+        pid_t tid = 0;
+        int depth = 0;
+        void* frames[kMaxDepth];
+    };
+
+    // Disarms the timer, waits out any handler still running and puts back
+    // the previous SIGPROF action. The buffer may be read or freed after;
+    // the caller still owns running().
+    static void stop(const struct sigaction& previous) {
+        struct itimerval timer = {};
+        setitimer(ITIMER_PROF, &timer, nullptr);
+        samples().store(nullptr);
+        while (inHandler().load() > 0) this_thread::yield();
+        // Ignoring discards a tick still pending, which the default action
+        // would turn into a crash
+        struct sigaction ignore = {};
+        ignore.sa_handler = SIG_IGN;
+        sigaction(SIGPROF, &ignore, nullptr);
+        sigaction(SIGPROF, &previous, nullptr);
+    }
+
+    // Only async-signal-safe work: an atomic slot claim, backtrace() and gettid
+    static void onSignal(int) {
+        int savedErrno = errno;
+        inHandler().fetch_add(1);
+        Sample* buffer = samples().load();
+        if (buffer) {
+            size_t index = next().fetch_add(1, memory_order_relaxed);
+            if (index < limit().load(memory_order_relaxed)) {
+                Sample& sample = buffer[index];
+                sample.tid = (pid_t)syscall(SYS_gettid);
+                sample.depth = backtrace(sample.frames, kMaxDepth);
+            }
+        }
+        inHandler().fetch_sub(1);
+        errno = savedErrno;
+    }
+
+    static string fold(const vector<Sample>& buffer, size_t taken) {
+        unordered_map<void*, string> symbols;
+        unordered_map<pid_t, string> threadNames;
+        unordered_map<string, size_t> stacks;
+
+        for (size_t i = 0; i < taken; i++) {
+            const Sample& sample = buffer[i];
+            auto [named, added] = threadNames.try_emplace(sample.tid);
+            if (added) named->second = threadName(sample.tid);
+
+            string stack = named->second;
+            // Frames 0 and 1 are this handler and the kernel's signal return trampoline
+            for (int f = sample.depth - 1; f >= 2; f--) {
+                auto [symbol, fresh] = symbols.try_emplace(sample.frames[f]);
+                if (fresh) symbol->second = symbolize(sample.frames[f]);
+                stack += ";" + symbol->second;
+            }
+            stacks[stack]++;
+        }
+
+        vector<pair<string, size_t>> sorted(stacks.begin(), stacks.end());
+        sort(sorted.begin(), sorted.end());
+        string folded;
+        for (const auto& [stack, count] : sorted) folded += stack + " " + to_string(count) + "\n";
+        return folded;
+    }
+
+    static string symbolize(void* address) {
+        Dl_info info;
+        if (!dladdr(address, &info)) return "??";
+        if (info.dli_sname) {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            string name = status == 0 ? withoutParameters(demangled) : info.dli_sname;
+            free(demangled);
+            return name;
+        }
+        // A symbol the binary doesn't export: module+offset, for addr2line
+        string module = info.dli_fname ? info.dli_fname : "??";
+        module = module.substr(module.rfind('/') + 1);
+        char offset[32];
+        snprintf(offset, sizeof(offset), "+0x%zx", (size_t)((char*)address - (char*)info.dli_fbase));
+        return module + offset;
+    }
+
+    // "ns::f(std::string const&) const" -> "ns::f", as perf shows frames;
+    // overloads rarely matter in a flame graph and full signatures swamp it
+    static string withoutParameters(string_view name) {
+        size_t end = name.rfind(')');
+        if (end == string_view::npos) return string(name);
+        int depth = 0;
+        for (size_t i = end + 1; i-- > 0;) {
+            if (name[i] == ')') depth++;
+            else if (name[i] == '(' && --depth == 0) return string(name.substr(0, i));
+        }
+        return string(name);
+    }
+
+    // The name Trace::nameThread gave it, or the process name for threads it
+    // didn't see (httplib's); exited threads keep their id
+    static string threadName(pid_t tid) {
+        ifstream comm("/proc/self/task/" + to_string(tid) + "/comm");
+        string name;
+        if (!getline(comm, name) || name.empty()) return "thread " + to_string(tid);
+        return name;
+    }
+
+    static atomic<bool>& running() {
+        static atomic<bool> flag{ false };
+        return flag;
+    }
+
+    // Handler state: plain atomics, usable from a signal handler
+    static atomic<Sample*>& samples() {
+        static atomic<Sample*> buffer{ nullptr };
+        return buffer;
+    }
+
+    static atomic<size_t>& next() {
+        static atomic<size_t> index{ 0 };
+        return index;
+    }
+
+    static atomic<size_t>& limit() {
+        static atomic<size_t> capacity{ 0 };
+        return capacity;
+    }
+
+    static atomic<int>& inHandler() {
+        static atomic<int> count{ 0 };
+        return count;
+    }
+};
+
+// A std::mutex that measures itself: how long contended lock() calls wait
+// for it and how long every holder keeps it, as Prometheus histograms. An
+// uncontended lock is a try_lock and two clock reads, cheap enough to leave on.
+class TimedMutex {
+public:
+    static constexpr array<double, 8> kBuckets = { 1e-6, 1e-5, 1e-4, 1e-3, 0.01, 0.1, 1, 10 };   // seconds
+
+    void lock() {
+        if (inner.try_lock()) {
+            acquiredAt = chrono::steady_clock::now();
+            return;
+        }
+        auto start = chrono::steady_clock::now();
+        inner.lock();
+        acquiredAt = chrono::steady_clock::now();
+        contended.fetch_add(1, memory_order_relaxed);
+        waits.add(acquiredAt - start);
+    }
+
+    bool try_lock() {
+        if (!inner.try_lock()) return false;
+        acquiredAt = chrono::steady_clock::now();
+        return true;
+    }
+
+    void unlock() {
+        auto held = chrono::steady_clock::now() - acquiredAt;
+        inner.unlock();
+        holds.add(held);
+    }
+
+    // realssa_lock_contended_total, realssa_lock_wait_seconds (contended
+    // acquisitions only) and realssa_lock_hold_seconds (every acquisition),
+    // labelled lock="<name>"
+    string metricsText(const string& name) const {
+        string label = "lock=\"" + name + "\"";
+        return "# HELP realssa_lock_contended_total Acquisitions that had to wait\n"
+            "# TYPE realssa_lock_contended_total counter\n"
+            "realssa_lock_contended_total{" + label + "} " + to_string(contended.load(memory_order_relaxed)) + "\n" +
+            waits.render("realssa_lock_wait_seconds", "Time spent waiting for the lock, when contended", label) +
+            holds.render("realssa_lock_hold_seconds", "Time the lock was held", label);
+    }
+
+private:
+    struct Histogram {
+        array<atomic<uint64_t>, kBuckets.size()> buckets{};   // per bucket, not cumulative
+        atomic<uint64_t> count{ 0 };
+        atomic<uint64_t> sumNanos{ 0 };
+
+        void add(chrono::steady_clock::duration elapsed) {
+            uint64_t nanos = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(elapsed).count();
+            size_t bucket = lower_bound(kBuckets.begin(), kBuckets.end(), nanos / 1e9) - kBuckets.begin();
+            if (bucket < kBuckets.size()) buckets[bucket].fetch_add(1, memory_order_relaxed);
+            count.fetch_add(1, memory_order_relaxed);
+            sumNanos.fetch_add(nanos, memory_order_relaxed);
+        }
+
+        string render(const string& metric, const string& help, const string& label) const {
+            string text = "# HELP " + metric + " " + help + "\n# TYPE " + metric + " histogram\n";
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < kBuckets.size(); i++) {
+                cumulative += buckets[i].load(memory_order_relaxed);
+                char le[16];
+                snprintf(le, sizeof(le), "%g", kBuckets[i]);
+                text += metric + "_bucket{" + label + ",le=\"" + le + "\"} " + to_string(cumulative) + "\n";
+            }
+            uint64_t total = max(count.load(memory_order_relaxed), cumulative);
+            text += metric + "_bucket{" + label + ",le=\"+Inf\"} " + to_string(total) + "\n";
+            text += metric + "_sum{" + label + "} " + to_string(sumNanos.load(memory_order_relaxed) / 1e9) + "\n";
+            text += metric + "_count{" + label + "} " + to_string(total) + "\n";
+            return text;
+        }
+    };
+
+    mutex inner;
+    chrono::steady_clock::time_point acquiredAt;   // written by the holder only
+    atomic<uint64_t> contended{ 0 };
+    Histogram waits;
+    Histogram holds;
+};
+
+// Heap allocations, counted by the operator new below when built with
+// -DREALSSA_ALLOC_STATS (and all zero otherwise). Every thread keeps its own
+// totals, which HTTPMetrics diffs around each request. Threads that never
+// served a request (fetching, parsing, publishing) also add to shared
+// background totals, which refresh() diffs.
+class AllocationStats {
+public:
+#ifdef REALSSA_ALLOC_STATS
+    static constexpr bool kEnabled = true;
+#else
+    static constexpr bool kEnabled = false;
+#endif
+
+    struct Counts {
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    static void record(size_t bytes) {
+        threadCounts.allocations++;
+        threadCounts.bytes += bytes;
+        if (requestThread) return;
+        backgroundAllocations.fetch_add(1, memory_order_relaxed);
+        backgroundBytes.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    static Counts thisThread() {
+        return threadCounts;
+    }
+
+    static Counts background() {
+        return { backgroundAllocations.load(memory_order_relaxed), backgroundBytes.load(memory_order_relaxed) };
+    }
+
+    // From then on the calling thread's allocations are only its own
+    static void markRequestThread() {
+        requestThread = true;
+    }
+
+private:
+    // Plain zero-initialized thread_locals: safe to touch from operator new
+    static thread_local Counts threadCounts;
+    static thread_local bool requestThread;
+    static atomic<uint64_t> backgroundAllocations;
+    static atomic<uint64_t> backgroundBytes;
+};
+
+thread_local AllocationStats::Counts AllocationStats::threadCounts{};
+thread_local bool AllocationStats::requestThread = false;
+atomic<uint64_t> AllocationStats::backgroundAllocations{ 0 };
+atomic<uint64_t> AllocationStats::backgroundBytes{ 0 };
+
+#ifdef REALSSA_ALLOC_STATS
+// Kept out of line: inlined, GCC sees new'd pointers reach free()
+__attribute__((noinline)) void* operator new(size_t size) {
+    AllocationStats::record(size);
+    if (void* block = malloc(size ? size : 1)) return block;
+    throw bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* block) noexcept {
+    free(block);
+}
+
+__attribute__((noinline)) void operator delete(void* block, size_t) noexcept {
+    free(block);
+}
+#endif
+
+// libcurl request setup and URL helpers for FetchScheduler
 class HTTPFetcher {
 public:
     static size_t WriteCallback(void* contents, size_t size, size_t nmemb, string* data) {
@@ -70,169 +663,2464 @@ public:
         return size * nmemb;
     }
 
-    static string fetch(const string& url) {
-        CURL* curl = curl_easy_init();
-        if (!curl) return "";
-
-        string response;
+    // Settings every transfer shares; FetchScheduler adds the per-request
+    // timeout and connection handling
+    static void configure(CURL* curl, const string& url, string* response) {
         curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
         curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
         curl_easy_setopt(curl, CURLOPT_USERAGENT, "Mozilla/5.0");
         curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+        // h2 over TLS where the server offers it; plain http stays on 1.1
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+    }
+
+    static const char* protocolName(long httpVersion) {
+        switch (httpVersion) {
+        case CURL_HTTP_VERSION_1_0: return "HTTP/1.0";
+        case CURL_HTTP_VERSION_1_1: return "HTTP/1.1";
+        case CURL_HTTP_VERSION_2_0: return "HTTP/2";
+        case CURL_HTTP_VERSION_3: return "HTTP/3";
+        default: return "unknown";
+        }
+    }
+
+    // "https://feeds.bbci.co.uk/news/rss.xml" -> "feeds.bbci.co.uk"
+    static string hostOf(const string& url) {
+        size_t start = url.find("://");
+        start = (start == string::npos) ? 0 : start + 3;
+        size_t end = url.find_first_of(":/?#", start);
+        return url.substr(start, end == string::npos ? string::npos : end - start);
+    }
+};
+
+// Fixed-size thread pool for CPU work (parsing) kept off the fetch I/O thread
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t threads) {
+        for (size_t i = 0; i < threads; i++) {
+            workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queueCV.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    void post(function<void()> task) {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            tasks.push_back(move(task));
+        }
+        queueCV.notify_one();
+    }
+
+    // Runs body(0) .. body(count - 1) and returns once all have finished. The
+    // calling thread claims indices alongside the helpers it posts, and only
+    // waits for ones already running, so a pool task can call this without
+    // deadlocking when every other worker is busy.
+    void parallelFor(size_t count, const function<void(size_t)>& body) {
+        if (count == 0) return;
+
+        struct Shared {
+            atomic<size_t> next{ 0 };
+            size_t done = 0;   // guarded by doneMutex
+            mutex doneMutex;
+            condition_variable doneCV;
+        };
+        auto shared = make_shared<Shared>();
+
+        // A helper that starts after every index is claimed returns without
+        // touching body, so only shared has to outlive this call
+        auto run = [shared, count, &body]() {
+            size_t finished = 0;
+            for (size_t i; (i = shared->next++) < count; finished++) body(i);
+            if (finished == 0) return;
+            lock_guard<mutex> lock(shared->doneMutex);
+            shared->done += finished;
+            if (shared->done == count) shared->doneCV.notify_all();
+        };
+
+        size_t helpers = min(count - 1, workers.size());
+        for (size_t i = 0; i < helpers; i++) post(run);
+        run();
+
+        unique_lock<mutex> lock(shared->doneMutex);
+        shared->doneCV.wait(lock, [&]() { return shared->done == count; });
+    }
+
+private:
+    void work() {
+        Trace::nameThread("worker");
+        while (true) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                queueCV.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (tasks.empty()) return;
+                task = move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    vector<thread> workers;
+    deque<function<void()>> tasks;
+    mutex queueMutex;
+    condition_variable queueCV;
+    bool stopping = false;
+};
+
+struct FetchResult {
+    CURLcode code = CURLE_OK;
+    long status = 0;
+    long httpVersion = 0;
+    // Seconds from the start of the transfer until each phase completed;
+    // connect and TLS are 0 on a reused connection, TLS also on plain http
+    double nameLookupTime = 0;
+    double connectTime = 0;
+    double appConnectTime = 0;
+    double startTransferTime = 0;   // first response byte
+    double totalTime = 0;
+    curl_off_t downloadBytes = 0;   // as transferred, before any decoding
+    string contentType;
+    vector<pair<string, string>> headers;   // final response's, if the scheduler keeps them
+    string body;
+
+    bool ok() const { return code == CURLE_OK && status < 400; }
+};
+
+// Runs every feed transfer on one curl multi handle. Requests wait in per-host
+// queues and are admitted round-robin across hosts, at most kMaxPerHost at a
+// time per host, so one publisher with many feeds neither gets throttled nor
+// starves the others. The multi handle keeps connections alive between
+// refreshes. Once a host is seen to speak HTTP/2, its requests are multiplexed
+// as streams over one connection and it may have kMaxStreamsPerHost in flight.
+// Completion callbacks run on the worker pool. Response headers are only
+// collected into results when keepHeaders is set (for recording fixtures).
+class FetchScheduler {
+public:
+    using Callback = function<void(FetchResult&&)>;
+
+    static constexpr size_t kMaxPerHost = 2;
+    static constexpr size_t kMaxStreamsPerHost = 8;
+    static constexpr size_t kMaxTotal = 32;
+
+    explicit FetchScheduler(WorkerPool& callbackPool, bool keepHeaders = false)
+        : callbacks(callbackPool), keepHeaders(keepHeaders) {
+        multi = curl_multi_init();
+        curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)kMaxPerHost);
+        curl_multi_setopt(multi, CURLMOPT_MAX_CONCURRENT_STREAMS, (long)kMaxStreamsPerHost);
+        curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, (long)kMaxTotal * 2);
+        ioThread = thread([this]() { run(); });
+    }
+
+    ~FetchScheduler() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        curl_multi_wakeup(multi);
+        ioThread.join();
+
+        for (auto& [easy, transfer] : active) {
+            curl_multi_remove_handle(multi, easy);
+            curl_easy_cleanup(easy);
+        }
+        curl_multi_cleanup(multi);
+    }
+
+    void submit(const string& url, Callback done, long timeoutMs = 30000) {
+        string host = HTTPFetcher::hostOf(url);
+        {
+            lock_guard<mutex> lock(queueMutex);
+            HostQueue& queue = hosts[host];
+            if (queue.pending.empty()) ready.push_back(host);
+            queue.pending.push_back({ url, timeoutMs, move(done) });
+        }
+        curl_multi_wakeup(multi);
+    }
+
+    string statsJSON() {
+        lock_guard<mutex> lock(queueMutex);
+        string json = "{\"active\":" + to_string(active.size()) + ",\"hosts\":{";
+        size_t i = 0;
+        for (const auto& [host, queue] : hosts) {
+            if (i++) json += ",";
+            json += "\"" + host + "\":{\"protocol\":\"" + HTTPFetcher::protocolName(queue.httpVersion) +
+                "\",\"pending\":" + to_string(queue.pending.size()) +
+                ",\"inFlight\":" + to_string(queue.inFlight) +
+                ",\"peakStreams\":" + to_string(queue.peakInFlight) +
+                ",\"connections\":" + to_string(queue.connections) +
+                ",\"reused\":" + to_string(queue.reused) +
+                ",\"completed\":" + to_string(queue.completed) +
+                ",\"failed\":" + to_string(queue.failed) + "}";
+        }
+        json += "}}";
+        return json;
+    }
+
+private:
+    struct Request {
+        string url;
+        long timeoutMs;
+        Callback done;
+    };
 
-        CURLcode res = curl_easy_perform(curl);
-        curl_easy_cleanup(curl);
+    struct HostQueue {
+        deque<Request> pending;
+        size_t inFlight = 0;
+        size_t completed = 0;
+        size_t failed = 0;
 
-        return (res == CURLE_OK) ? response : "";
+        long httpVersion = 0;      // as negotiated on the last transfer
+        size_t peakInFlight = 0;   // most concurrent requests (streams, on h2)
+        size_t connections = 0;    // new connections opened
+        size_t reused = 0;         // transfers that rode an existing connection
+
+        size_t limit() const {
+            return httpVersion == CURL_HTTP_VERSION_2_0 ? kMaxStreamsPerHost : kMaxPerHost;
+        }
+    };
+
+    struct Transfer {
+        string host;
+        string body;
+        vector<pair<string, string>> headers;   // only with keepHeaders
+        Callback done;
+    };
+
+    // One header line per call. Each response (including redirects) starts
+    // with its status line, so only the last response's headers are kept.
+    static size_t HeaderCallback(char* line, size_t size, size_t nmemb, Transfer* transfer) {
+        string_view text(line, size * nmemb);
+        if (text.compare(0, 5, "HTTP/") == 0) {
+            transfer->headers.clear();
+            return size * nmemb;
+        }
+        size_t colon = text.find(':');
+        if (colon == string_view::npos) return size * nmemb;   // the blank line ending the block
+
+        string_view value = text.substr(colon + 1);
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+        while (!value.empty() && isspace((unsigned char)value.back())) value.remove_suffix(1);
+        transfer->headers.push_back({ string(text.substr(0, colon)), string(value) });
+        return size * nmemb;
+    }
+
+    void run() {
+        Trace::nameThread("fetch I/O");
+        while (true) {
+            {
+                lock_guard<mutex> lock(queueMutex);
+                if (stopping) return;
+                admit();
+            }
+
+            int running = 0;
+            curl_multi_perform(multi, &running);
+
+            int queued = 0;
+            bool freed = false;
+            while (CURLMsg* msg = curl_multi_info_read(multi, &queued)) {
+                if (msg->msg == CURLMSG_DONE) {
+                    complete(msg->easy_handle, msg->data.result);
+                    freed = true;
+                }
+            }
+
+            // A finished transfer frees a slot; admit the next request now
+            // rather than after the poll, which may sit out its full timeout
+            if (freed) continue;
+            curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+        }
+    }
+
+    // Caller must hold queueMutex. Walks the ring of hosts with pending
+    // requests, starting one request per host per turn.
+    void admit() {
+        size_t skipped = 0;
+        while (active.size() < kMaxTotal && !ready.empty() && skipped < ready.size()) {
+            string host = move(ready.front());
+            ready.pop_front();
+
+            HostQueue& queue = hosts[host];
+            if (queue.inFlight >= queue.limit()) {
+                ready.push_back(move(host));
+                skipped++;
+                continue;
+            }
+
+            start(host, queue);
+            skipped = 0;
+            if (!queue.pending.empty()) ready.push_back(move(host));
+        }
+    }
+
+    void start(const string& host, HostQueue& queue) {
+        Request request = move(queue.pending.front());
+        queue.pending.pop_front();
+
+        CURL* easy = curl_easy_init();
+        if (!easy) {
+            queue.failed++;
+            callbacks.post([done = move(request.done)]() mutable {
+                FetchResult result;
+                result.code = CURLE_FAILED_INIT;
+                done(move(result));
+            });
+            return;
+        }
+
+        auto transfer = make_unique<Transfer>();
+        transfer->host = host;
+        transfer->done = move(request.done);
+        HTTPFetcher::configure(easy, request.url, &transfer->body);
+        // Wait for an in-progress connection to this host rather than opening
+        // another, so h2 requests end up as streams on one connection
+        curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+        curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, request.timeoutMs);
+        if (keepHeaders) {
+            curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, HeaderCallback);
+            curl_easy_setopt(easy, CURLOPT_HEADERDATA, transfer.get());
+        }
+
+        queue.inFlight++;
+        queue.peakInFlight = max(queue.peakInFlight, queue.inFlight);
+        active[easy] = move(transfer);
+        curl_multi_add_handle(multi, easy);
+    }
+
+    void complete(CURL* easy, CURLcode code) {
+        FetchResult result;
+        result.code = code;
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &result.status);
+        curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &result.httpVersion);
+        curl_easy_getinfo(easy, CURLINFO_NAMELOOKUP_TIME, &result.nameLookupTime);
+        curl_easy_getinfo(easy, CURLINFO_CONNECT_TIME, &result.connectTime);
+        curl_easy_getinfo(easy, CURLINFO_APPCONNECT_TIME, &result.appConnectTime);
+        curl_easy_getinfo(easy, CURLINFO_STARTTRANSFER_TIME, &result.startTransferTime);
+        curl_easy_getinfo(easy, CURLINFO_TOTAL_TIME, &result.totalTime);
+        curl_easy_getinfo(easy, CURLINFO_SIZE_DOWNLOAD_T, &result.downloadBytes);
+        char* contentType = nullptr;
+        curl_easy_getinfo(easy, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType) result.contentType = contentType;
+        long newConnections = 0;
+        curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &newConnections);
+        curl_multi_remove_handle(multi, easy);
+        curl_easy_cleanup(easy);
+
+        unique_ptr<Transfer> transfer;
+        {
+            lock_guard<mutex> lock(queueMutex);
+            auto it = active.find(easy);
+            transfer = move(it->second);
+            active.erase(it);
+
+            HostQueue& queue = hosts[transfer->host];
+            queue.inFlight--;
+            if (result.ok()) queue.completed++;
+            else queue.failed++;
+
+            if (result.httpVersion) queue.httpVersion = result.httpVersion;
+            queue.connections += newConnections;
+            if (result.ok() && newConnections == 0) queue.reused++;
+        }
+
+        result.body = move(transfer->body);
+        result.headers = move(transfer->headers);
+        callbacks.post([done = move(transfer->done), result = move(result)]() mutable {
+            done(move(result));
+        });
+    }
+
+    WorkerPool& callbacks;
+    bool keepHeaders;
+    CURLM* multi = nullptr;
+    thread ioThread;
+
+    mutex queueMutex;
+    unordered_map<string, HostQueue> hosts;
+    deque<string> ready;
+    unordered_map<CURL*, unique_ptr<Transfer>> active;
+    bool stopping = false;
+};
+
+// Fast non-cryptographic 64-bit hash (MurmurHash64A), used to spot feed bodies
+// that are byte-for-byte unchanged since the previous fetch, and item guids
+class ContentHash {
+public:
+    static uint64_t hash64(string_view data, uint64_t seed = 0x9E3779B97F4A7C15ULL) {
+        const uint64_t m = 0xc6a4a7935bd1e995ULL;
+        const int r = 47;
+
+        size_t len = data.size();
+        const char* p = data.data();
+        const char* end = p + (len & ~(size_t)7);
+        uint64_t h = seed ^ (len * m);
+
+        for (; p != end; p += 8) {
+            uint64_t k;
+            memcpy(&k, p, 8);
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+
+        if (len & 7) {
+            uint64_t tail = 0;
+            memcpy(&tail, p, len & 7);
+            h ^= tail;
+            h *= m;
+        }
+
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+};
+
+// A parsed feed item. Items are immutable once parsed and shared by pointer
+// between generations.
+struct NewsItem {
+    string title;
+    string link;
+    string description;
+    string pubDate;
+    string source;
+    string category;
+    string country;
+    string imageUrl;
+    int64_t published = 0;   // pubDate as Unix time, 0 if it did not parse
+
+    string toJSON() const {
+        char publishedText[24];
+        char* end = to_chars(publishedText, publishedText + sizeof(publishedText), published).ptr;
+        return JSON::object({
+            { "title", title },
+            { "link", link },
+            { "description", description },
+            { "pubDate", pubDate },
+            { "published", string_view(publishedText, end - publishedText), true },
+            { "source", source },
+            { "category", category },
+            { "country", country },
+            { "imageUrl", imageUrl },
+            });
     }
 };
 
-// Simple XML parser
+using FeedItems = vector<shared_ptr<const NewsItem>>;
+
+// Items of the previous fetch keyed by a hash of their raw guid (or link), for
+// carrying them over
+using ItemIndex = unordered_map<uint64_t, shared_ptr<const NewsItem>>;
+
+// Byte-class search for the parser's hot loops: the next '<', '>' or '&', or
+// the "]]>" that ends a CDATA section. Single bytes go to memchr, which glibc
+// already vectorizes. The "either of two bytes" search that text cleaning
+// lives on has its own kernels, comparing 32 bytes at a time with AVX2 when
+// the CPU has it (picked once at startup), 16 with SSE2 otherwise, and a plain
+// loop off x86. Results follow string_view: an absolute position, or npos.
+class ByteScan {
+public:
+    static size_t find(string_view text, size_t from, char c) {
+        if (from >= text.size()) return string_view::npos;
+        const void* hit = memchr(text.data() + from, c, text.size() - from);
+        return hit ? static_cast<const char*>(hit) - text.data() : string_view::npos;
+    }
+
+    // First a or b at or after from
+    static size_t findEither(string_view text, size_t from, char a, char b) {
+        if (from >= text.size()) return string_view::npos;
+        size_t n = text.size() - from;
+        size_t found = kernels.either(text.data() + from, n, a, b);
+        return found == n ? string_view::npos : from + found;
+    }
+
+    // ']' is rare in feed text, so hopping between them with memchr beats
+    // matching all three bytes of "]]>" in vector registers
+    static size_t findCDataEnd(string_view text, size_t from) {
+        size_t pos = from;
+        while ((pos = find(text, pos, ']')) != string_view::npos) {
+            if (pos + 2 >= text.size()) return string_view::npos;
+            if (text[pos + 1] == ']' && text[pos + 2] == '>') return pos;
+            pos++;
+        }
+        return string_view::npos;
+    }
+
+    // First byte with the high bit set, i.e. not ASCII
+    static size_t findNonASCII(string_view text, size_t from) {
+        if (from >= text.size()) return string_view::npos;
+        size_t n = text.size() - from;
+        size_t found = kernels.nonASCII(text.data() + from, n);
+        return found == n ? string_view::npos : from + found;
+    }
+
+    static const char* isa() { return kernels.name; }
+
+private:
+    // Returns an offset into [p, p + n), or n if nothing matched
+    struct Kernels {
+        const char* name;
+        size_t (*either)(const char* p, size_t n, char a, char b);
+        size_t (*nonASCII)(const char* p, size_t n);
+    };
+
+    static const Kernels kernels;
+
+    static Kernels select() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return { "avx2", eitherAVX2, nonASCIIAVX2 };
+#if defined(__SSE2__)
+        return { "sse2", eitherSSE2, nonASCIISSE2 };
+#endif
+#endif
+        return { "scalar", eitherScalar, nonASCIIScalar };
+    }
+
+    static size_t eitherScalar(const char* p, size_t n, char a, char b) {
+        for (size_t i = 0; i < n; i++) {
+            if (p[i] == a || p[i] == b) return i;
+        }
+        return n;
+    }
+
+    static size_t nonASCIIScalar(const char* p, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (static_cast<unsigned char>(p[i]) >= 0x80) return i;
+        }
+        return n;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__SSE2__)
+    static size_t eitherSSE2(const char* p, size_t n, char a, char b) {
+        const __m128i va = _mm_set1_epi8(a);
+        const __m128i vb = _mm_set1_epi8(b);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            unsigned mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)));
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return i + eitherScalar(p + i, n - i, a, b);
+    }
+
+    // movemask gathers the high bit of every byte, so no compare is needed
+    static size_t nonASCIISSE2(const char* p, size_t n) {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            unsigned mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return i + nonASCIIScalar(p + i, n - i);
+    }
+#endif
+
+    __attribute__((target("avx2")))
+    static size_t eitherAVX2(const char* p, size_t n, char a, char b) {
+        const __m256i va = _mm256_set1_epi8(a);
+        const __m256i vb = _mm256_set1_epi8(b);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            unsigned mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)));
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return i + eitherScalar(p + i, n - i, a, b);
+    }
+
+    __attribute__((target("avx2")))
+    static size_t nonASCIIAVX2(const char* p, size_t n) {
+        size_t i = 0;
+        for (; i + 64 <= n; i += 64) {
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32));
+            if (!_mm256_movemask_epi8(_mm256_or_si256(lo, hi))) continue;
+            unsigned mask = _mm256_movemask_epi8(lo);
+            if (mask) return i + __builtin_ctz(mask);
+            return i + 32 + __builtin_ctz((unsigned)_mm256_movemask_epi8(hi));
+        }
+        for (; i + 32 <= n; i += 32) {
+            unsigned mask = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return i + nonASCIIScalar(p + i, n - i);
+    }
+#endif
+};
+
+const ByteScan::Kernels ByteScan::kernels = ByteScan::select();
+
+// Everything downstream of ingest assumes UTF-8. A body that already is valid
+// UTF-8 (ASCII included) is used as fetched, whatever it claims to be, since
+// mislabelled UTF-8 is far more common than legacy text that happens to
+// validate. Anything else is transcoded from the charset named by the
+// Content-Type header or the XML declaration: the ISO-8859-1 family is read
+// as windows-1252, as browsers do, and any other label gets its invalid
+// sequences replaced with U+FFFD.
+class TextEncoding {
+public:
+    enum class Charset { UTF8, Windows1252 };
+
+    // body as UTF-8: the body itself, or a view of storage holding the
+    // converted text
+    static string_view toUTF8(string_view body, string_view contentType, string& storage) {
+        size_t valid = validPrefix(body);
+        if (valid == body.size()) return body;
+
+        if (detect(body, contentType) == Charset::Windows1252) storage = fromWindows1252(body);
+        else storage = repair(body, valid);
+        return storage;
+    }
+
+    // Length of the longest prefix of text that is valid UTF-8. ASCII runs
+    // are skipped with the vector kernels; only multi-byte sequences are
+    // decoded, checking for overlong forms, surrogates and values past
+    // U+10FFFF.
+    static size_t validPrefix(string_view text) {
+        size_t pos = 0;
+        while ((pos = ByteScan::findNonASCII(text, pos)) != string_view::npos) {
+            while (pos < text.size() && static_cast<unsigned char>(text[pos]) >= 0x80) {
+                size_t length = sequenceLength(text, pos);
+                if (length == 0) return pos;
+                pos += length;
+            }
+        }
+        return text.size();
+    }
+
+    // The charset a non-UTF-8 body declares; the header wins over the XML
+    // declaration
+    static Charset detect(string_view body, string_view contentType) {
+        string_view label = parameter(contentType, "charset=");
+        if (label.empty()) label = prologEncoding(body);
+        return isWindows1252(label) ? Charset::Windows1252 : Charset::UTF8;
+    }
+
+    static string fromWindows1252(string_view text) {
+        string result(text.size() * 3, '\0');
+        char* out = result.data();
+        size_t written = 0;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t high = ByteScan::findNonASCII(text, pos);
+            if (high == string_view::npos) high = text.size();
+            memcpy(out + written, text.data() + pos, high - pos);
+            written += high - pos;
+            for (pos = high; pos < text.size() && static_cast<unsigned char>(text[pos]) >= 0x80; pos++) {
+                const Encoded& encoded = kWindows1252UTF8[static_cast<unsigned char>(text[pos]) - 0x80];
+                memcpy(out + written, encoded.bytes, 3);
+                written += encoded.length;
+            }
+        }
+        result.resize(written);
+        return result;
+    }
+
+    static constexpr uint32_t fromWindows1252(uint8_t byte) {
+        // The five bytes windows-1252 leaves undefined map to the C1
+        // controls, following the WHATWG encoding standard
+        return byte >= 0x80 && byte <= 0x9F && kC1[byte - 0x80] ? kC1[byte - 0x80] : byte;
+    }
+
+    static constexpr size_t encodeUTF8(uint32_t cp, char* out) {
+        if (cp < 0x80) {
+            out[0] = (char)cp;
+            return 1;
+        }
+        if (cp < 0x800) {
+            out[0] = (char)(0xC0 | (cp >> 6));
+            out[1] = (char)(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            out[0] = (char)(0xE0 | (cp >> 12));
+            out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = (char)(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        out[0] = (char)(0xF0 | (cp >> 18));
+        out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+private:
+    struct Encoded {
+        char bytes[3];
+        uint8_t length;
+    };
+
+    static constexpr uint16_t kC1[32] = {
+        0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+        0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+    };
+
+    // UTF-8 for bytes 0x80-0xFF; every one fits in three bytes
+    static constexpr array<Encoded, 128> buildWindows1252() {
+        array<Encoded, 128> table{};
+        for (size_t i = 0; i < table.size(); i++) {
+            char bytes[4] = {};
+            table[i].length = (uint8_t)encodeUTF8(fromWindows1252((uint8_t)(0x80 + i)), bytes);
+            for (size_t j = 0; j < 3; j++) table[i].bytes[j] = bytes[j];
+        }
+        return table;
+    }
+
+    static const array<Encoded, 128> kWindows1252UTF8;
+
+    // Bytes in the well-formed sequence starting at text[pos] (a lead byte),
+    // or 0 if it is not one
+    static size_t sequenceLength(string_view text, size_t pos) {
+        size_t length = 0;
+        size_t matched = matchSequence(text, pos, length);
+        return matched == length ? length : 0;
+    }
+
+    // How many bytes from text[pos] fit the sequence its lead byte starts,
+    // which is `length` bytes when well-formed. Fewer is the maximal subpart
+    // of an ill-formed sequence, which repair replaces as a unit.
+    static size_t matchSequence(string_view text, size_t pos, size_t& length) {
+        unsigned char lead = static_cast<unsigned char>(text[pos]);
+        unsigned char low = 0x80, high = 0xBF;   // bounds for the second byte
+        if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+        else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            if (lead == 0xE0) low = 0xA0;         // overlong
+            else if (lead == 0xED) high = 0x9F;   // surrogates
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            if (lead == 0xF0) low = 0x90;         // overlong
+            else if (lead == 0xF4) high = 0x8F;   // past U+10FFFF
+        }
+        else {
+            length = 1;
+            return 0;
+        }
+
+        size_t matched = 1;
+        while (matched < length && pos + matched < text.size()) {
+            unsigned char c = static_cast<unsigned char>(text[pos + matched]);
+            if (matched == 1 ? (c < low || c > high) : (c < 0x80 || c > 0xBF)) break;
+            matched++;
+        }
+        return matched;
+    }
+
+    // Copies text, valid from the start up to validUpTo, replacing each
+    // ill-formed subsequence with one U+FFFD
+    static string repair(string_view text, size_t validUpTo) {
+        string result;
+        result.reserve(text.size() + 16);
+        result.append(text.data(), validUpTo);
+        size_t pos = validUpTo;
+        while (pos < text.size()) {
+            size_t valid = validPrefix(text.substr(pos));
+            result.append(text.data() + pos, valid);
+            pos += valid;
+            if (pos < text.size()) {
+                size_t length = 0;
+                result += "\xEF\xBF\xBD";
+                pos += max<size_t>(matchSequence(text, pos, length), 1);
+            }
+        }
+        return result;
+    }
+
+    // Value of name (e.g. "charset=") in a header, unquoted
+    static string_view parameter(string_view header, string_view name) {
+        size_t pos = findCaseless(header, name);
+        if (pos == string_view::npos) return {};
+        string_view value = header.substr(pos + name.size());
+        if (!value.empty() && (value[0] == '"' || value[0] == '\'')) {
+            char quote = value[0];
+            value.remove_prefix(1);
+            return value.substr(0, value.find(quote));
+        }
+        return value.substr(0, value.find_first_of("; \t"));
+    }
+
+    // encoding="..." of an <?xml ...?> declaration at the start of body
+    static string_view prologEncoding(string_view body) {
+        if (body.compare(0, 5, "<?xml") != 0) return {};
+        string_view prolog = body.substr(0, body.find("?>"));
+        size_t pos = prolog.find("encoding");
+        if (pos == string_view::npos) return {};
+        pos = prolog.find_first_of("\"'", pos);
+        if (pos == string_view::npos) return {};
+        size_t end = prolog.find(prolog[pos], pos + 1);
+        if (end == string_view::npos) return {};
+        return prolog.substr(pos + 1, end - pos - 1);
+    }
+
+    static bool isWindows1252(string_view label) {
+        for (string_view name : { "windows-1252", "iso-8859-1", "iso8859-1", "iso_8859-1", "latin1", "l1",
+                 "cp1252", "x-cp1252", "cp819", "ibm819", "us-ascii", "ascii" }) {
+            if (label.size() == name.size() && findCaseless(label, name) == 0) return true;
+        }
+        return false;
+    }
+
+    static size_t findCaseless(string_view text, string_view needle) {
+        if (needle.size() > text.size()) return string_view::npos;
+        for (size_t i = 0; i + needle.size() <= text.size(); i++) {
+            size_t j = 0;
+            while (j < needle.size() && tolower(static_cast<unsigned char>(text[i + j])) == needle[j]) j++;
+            if (j == needle.size()) return i;
+        }
+        return string_view::npos;
+    }
+};
+
+const array<TextEncoding::Encoded, 128> TextEncoding::kWindows1252UTF8 = TextEncoding::buildWindows1252();
+
+// Element names the feed tokenizer cares about
+enum class FeedTag : uint8_t {
+    None,
+    Item,
+    Title,
+    Link,
+    Description,
+    PubDate,
+    Guid,
+    MediaContent,
+    MediaThumbnail,
+    Enclosure,
+    Entry,
+    Content,
+    Updated,
+    AtomLink,   // not in the table: an Atom-namespace "link"
+};
+
+// Compile-time perfect hash from element name to FeedTag. Any other name hashes
+// to a slot whose stored name won't match, so a lookup is one hash and at most
+// one compare.
+class FeedTagTable {
+public:
+    static constexpr size_t kSize = 64;
+
+    static constexpr size_t hash(string_view name) {
+        return (name.size() * 3 + (unsigned char)name[0] * 2 +
+            (unsigned char)name[name.size() - 1] * 33 + (unsigned char)name[name.size() / 2]) & (kSize - 1);
+    }
+
+    static FeedTag lookup(string_view name) {
+        if (name.empty()) return FeedTag::None;
+        const Entry& entry = kTable[hash(name)];
+        return entry.name == name ? entry.tag : FeedTag::None;
+    }
+
+    static constexpr bool isPerfect() {
+        for (size_t i = 0; i < size(kTags); i++) {
+            for (size_t j = i + 1; j < size(kTags); j++) {
+                if (hash(kTags[i].name) == hash(kTags[j].name)) return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Entry {
+        string_view name;
+        FeedTag tag = FeedTag::None;
+    };
+
+    static constexpr Entry kTags[] = {
+        { "item", FeedTag::Item },
+        { "title", FeedTag::Title },
+        { "link", FeedTag::Link },
+        { "description", FeedTag::Description },
+        { "pubDate", FeedTag::PubDate },
+        { "guid", FeedTag::Guid },
+        { "media:content", FeedTag::MediaContent },
+        { "media:thumbnail", FeedTag::MediaThumbnail },
+        { "enclosure", FeedTag::Enclosure },
+        // Atom, and the RSS 1.0 (RDF) / Dublin Core forms
+        { "entry", FeedTag::Entry },
+        { "summary", FeedTag::Description },
+        { "content", FeedTag::Content },
+        { "content:encoded", FeedTag::Content },
+        { "published", FeedTag::PubDate },
+        { "dc:date", FeedTag::PubDate },
+        { "updated", FeedTag::Updated },
+        { "id", FeedTag::Guid },
+    };
+
+    static constexpr array<Entry, kSize> build() {
+        array<Entry, kSize> table{};
+        for (const Entry& entry : kTags) table[hash(entry.name)] = entry;
+        return table;
+    }
+
+    static const array<Entry, kSize> kTable;
+};
+
+static_assert(FeedTagTable::isPerfect(), "FeedTagTable::hash collides; retune its constants");
+
+const array<FeedTagTable::Entry, FeedTagTable::kSize> FeedTagTable::kTable = FeedTagTable::build();
+
+// Single-pass scanner over a feed document. Every element name is read once
+// and classified through FeedTagTable; the fields of each <item> (RSS 2.0 and
+// RDF) or <entry> (Atom) are captured as slices of the document in the same
+// sweep instead of being searched for one by one.
+class FeedTokenizer {
+public:
+    struct RawItem {
+        string_view title;
+        string_view link;
+        string_view description;
+        string_view pubDate;
+        string_view guid;
+
+        // Image candidates: the whole start tag, '<' up to '>'
+        string_view mediaContent;
+        string_view mediaThumbnail;
+        string_view enclosure;
+
+        // Stand-ins, folded into the fields above when the item closes if
+        // those are missing: content / content:encoded for description,
+        // Atom updated for pubDate, and the alternate Atom link's start tag
+        // (its href) for link
+        string_view content;
+        string_view updated;
+        string_view linkTag;
+    };
+
+    static constexpr string_view kAtomNamespace = "http://www.w3.org/2005/Atom";
+
+    // Value of name="..." (or '...') within one start tag
+    static string_view attribute(string_view startTag, string_view name) {
+        size_t attrPos = findAttribute(startTag, name, '"');
+        if (attrPos == string_view::npos) {
+            attrPos = findAttribute(startTag, name, '\'');
+            if (attrPos == string_view::npos) return {};
+        }
+
+        size_t startQuote = startTag.find('"', attrPos);
+        if (startQuote == string_view::npos) startQuote = startTag.find('\'', attrPos);
+        if (startQuote == string_view::npos) return {};
+
+        size_t endQuote = startTag.find('"', startQuote + 1);
+        if (endQuote == string_view::npos) endQuote = startTag.find('\'', startQuote + 1);
+        if (endQuote == string_view::npos) return {};
+
+        return startTag.substr(startQuote + 1, endQuote - startQuote - 1);
+    }
+
+    // Calls onItem(const RawItem&) for each item in document order until it
+    // returns false
+    template <typename OnItem>
+    static void forEachItem(string_view doc, OnItem&& onItem) {
+        RawItem item;
+        bool inItem = false;
+        bool sawRoot = false;
+        Namespaces ns;
+        size_t pos = 0;
+
+        while ((pos = ByteScan::find(doc, pos, '<')) != string_view::npos) {
+            if (size_t next = skipMarkup(doc, pos)) {
+                pos = next;
+                continue;
+            }
+
+            bool closing = pos + 1 < doc.size() && doc[pos + 1] == '/';
+            size_t nameStart = pos + (closing ? 2 : 1);
+            size_t nameEnd = nameStart;
+            while (nameEnd < doc.size() && !isNameEnd(doc[nameEnd])) nameEnd++;
+
+            size_t tagEnd = ByteScan::find(doc, nameEnd, '>');
+            if (tagEnd == string_view::npos) break;
+
+            string_view name = doc.substr(nameStart, nameEnd - nameStart);
+            if (!sawRoot && !closing) {
+                sawRoot = true;
+                ns = namespacesOf(name, doc.substr(nameEnd, tagEnd - nameEnd));
+            }
+            FeedTag tag = classify(name, ns);
+            bool selfClosing = doc[tagEnd - 1] == '/';
+
+            if (tag == FeedTag::Item || tag == FeedTag::Entry) {
+                if (!closing && !selfClosing) {
+                    item = RawItem();
+                    inItem = true;
+                }
+                else if (closing && inItem) {
+                    inItem = false;
+                    if (!item.description.data()) item.description = item.content;
+                    if (!item.pubDate.data()) item.pubDate = item.updated;
+                    if (!item.link.data()) item.link = attribute(item.linkTag, "href");
+                    if (!onItem(item)) return;
+                }
+            }
+            else if (!closing && inItem) {
+                // Image tags usually close themselves and may nest in
+                // media:group, so only the start tag is kept and the scan
+                // carries on inside. Atom links are empty elements too.
+                if (string_view* candidate = imageFor(item, tag)) {
+                    if (!candidate->data()) *candidate = doc.substr(pos, tagEnd - pos);
+                }
+                else if (tag == FeedTag::AtomLink) {
+                    string_view startTag = doc.substr(pos, tagEnd - pos);
+                    string_view rel = attribute(startTag, "rel");
+                    if (!item.linkTag.data() && (rel.empty() || rel == "alternate")) item.linkTag = startTag;
+                }
+                else if (string_view* field = selfClosing ? nullptr : fieldFor(item, tag)) {
+                    size_t close = findClose(doc, tagEnd + 1, name);
+                    if (close == string_view::npos) break;
+                    // First occurrence wins, as with extractTag
+                    if (!field->data()) *field = doc.substr(tagEnd + 1, close - tagEnd - 1);
+                    pos = close + 2 + name.size();
+                    continue;
+                }
+            }
+
+            pos = tagEnd + 1;
+        }
+    }
+
+private:
+    // Where the document binds the Atom namespace, from its root element
+    struct Namespaces {
+        bool atomDefault = false;   // unprefixed names are Atom
+        string_view atomPrefix;     // e.g. "atom" or "a10"
+    };
+
+    static Namespaces namespacesOf(string_view rootName, string_view attributes) {
+        Namespaces ns;
+        // An Atom document that forgot its xmlns is still Atom
+        ns.atomDefault = rootName == "feed";
+
+        size_t pos = 0;
+        while ((pos = attributes.find("xmlns", pos)) != string_view::npos) {
+            pos += 5;
+            size_t eq = attributes.find('=', pos);
+            if (eq == string_view::npos) break;
+            string_view prefix;
+            if (attributes[pos] == ':') prefix = attributes.substr(pos + 1, eq - pos - 1);
+            else if (eq != pos) continue;
+
+            size_t open = eq + 1;
+            if (open >= attributes.size() || (attributes[open] != '"' && attributes[open] != '\'')) continue;
+            size_t close = attributes.find(attributes[open], open + 1);
+            if (close == string_view::npos) break;
+            if (attributes.substr(open + 1, close - open - 1) == kAtomNamespace) {
+                if (prefix.empty()) ns.atomDefault = true;
+                else ns.atomPrefix = prefix;
+            }
+            pos = close + 1;
+        }
+        return ns;
+    }
+
+    // Atom names are matched by namespace, not spelling: unprefixed names in
+    // an Atom document, or names under the prefix bound to Atom. Only there
+    // is "link" an empty element with an href, and "entry" an item.
+    static FeedTag classify(string_view name, const Namespaces& ns) {
+        if (!ns.atomDefault && ns.atomPrefix.empty()) {
+            FeedTag tag = FeedTagTable::lookup(name);
+            return tag == FeedTag::Entry ? FeedTag::None : tag;
+        }
+        return classifyAtom(name, ns);
+    }
+
+    static FeedTag classifyAtom(string_view name, const Namespaces& ns) {
+        string_view local = name;
+        bool atom;
+        size_t prefixLength = ns.atomPrefix.size();
+        if (prefixLength && name.size() > prefixLength && name[prefixLength] == ':' &&
+            name.compare(0, prefixLength, ns.atomPrefix) == 0) {
+            local = name.substr(prefixLength + 1);
+            atom = true;
+        }
+        else {
+            atom = ns.atomDefault && name.find(':') == string_view::npos;
+        }
+
+        FeedTag tag = FeedTagTable::lookup(local);
+        if (atom) {
+            if (tag == FeedTag::Link) return FeedTag::AtomLink;
+            if (tag == FeedTag::Item) return FeedTag::None;
+        }
+        else if (tag == FeedTag::Entry) {
+            return FeedTag::None;
+        }
+        return tag;
+    }
+
+    static string_view* fieldFor(RawItem& item, FeedTag tag) {
+        switch (tag) {
+        case FeedTag::Title: return &item.title;
+        case FeedTag::Link: return &item.link;
+        case FeedTag::Description: return &item.description;
+        case FeedTag::PubDate: return &item.pubDate;
+        case FeedTag::Guid: return &item.guid;
+        case FeedTag::Content: return &item.content;
+        case FeedTag::Updated: return &item.updated;
+        default: return nullptr;
+        }
+    }
+
+    // Position of name="  (or name=' with quote '\'')
+    static size_t findAttribute(string_view startTag, string_view name, char quote) {
+        size_t pos = 0;
+        while ((pos = startTag.find(name, pos)) != string_view::npos) {
+            size_t after = pos + name.length();
+            if (after + 1 < startTag.size() && startTag[after] == '=' && startTag[after + 1] == quote) return pos;
+            pos++;
+        }
+        return string_view::npos;
+    }
+
+    static string_view* imageFor(RawItem& item, FeedTag tag) {
+        switch (tag) {
+        case FeedTag::MediaContent: return &item.mediaContent;
+        case FeedTag::MediaThumbnail: return &item.mediaThumbnail;
+        case FeedTag::Enclosure: return &item.enclosure;
+        default: return nullptr;
+        }
+    }
+
+    static bool isNameEnd(char c) {
+        return c == '>' || c == '/' || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    // Comments, CDATA, processing instructions and declarations: returns the
+    // position just past them, or 0 if pos starts an ordinary tag
+    static size_t skipMarkup(string_view doc, size_t pos) {
+        if (pos + 1 >= doc.size()) return doc.size();
+        char c = doc[pos + 1];
+        if (c != '!' && c != '?') return 0;
+
+        string_view terminator = ">";
+        size_t end;
+        if (doc.compare(pos, 9, "<![CDATA[") == 0) {
+            terminator = "]]>";
+            end = ByteScan::findCDataEnd(doc, pos + 9);
+        }
+        else {
+            if (doc.compare(pos, 4, "<!--") == 0) terminator = "-->";
+            else if (c == '?') terminator = "?>";
+            end = doc.find(terminator, pos + 2);
+        }
+        return end == string_view::npos ? doc.size() : end + terminator.size();
+    }
+
+    // Position of the "</name" that closes an element whose content starts at
+    // from, stepping over CDATA sections and any markup nested in the content
+    static size_t findClose(string_view doc, size_t from, string_view name) {
+        size_t pos = from;
+        while ((pos = ByteScan::find(doc, pos, '<')) != string_view::npos) {
+            if (doc.compare(pos, 9, "<![CDATA[") == 0) {
+                size_t end = ByteScan::findCDataEnd(doc, pos + 9);
+                if (end == string_view::npos) return string_view::npos;
+                pos = end + 3;
+                continue;
+            }
+
+            size_t after = pos + 2 + name.size();
+            if (after < doc.size() && doc[pos + 1] == '/' && doc.compare(pos + 2, name.size(), name) == 0 &&
+                isNameEnd(doc[after])) {
+                return pos;
+            }
+            pos++;
+        }
+        return string_view::npos;
+    }
+};
+
+// Named character references (the HTML5 set, less &nGt; and &nLt;, whose
+// expansions are longer than they are) sorted by name for binary search,
+// including the legacy names HTML also reads without a ';', and numeric
+// reference decoding. No reference encodes to more UTF-8 bytes than its own
+// text, which lets cleanText decode in place.
+class HTMLEntities {
+public:
+    struct Entity {
+        string_view name;
+        string_view utf8;
+    };
+
+    static constexpr size_t kMaxUTF8 = 8;     // bytes any one reference decodes to
+
+    // Decodes the reference starting at text[amp] == '&' into out (kMaxUTF8 bytes).
+    // Returns the bytes written and sets consumed, or returns 0 if it is not a
+    // complete reference. xmlOnly limits named references to XML's five, each
+    // with its ';'.
+    static size_t decode(string_view text, size_t amp, bool xmlOnly, char* out, size_t& consumed) {
+        size_t limit = min(text.size(), amp + kMaxLength + 1);
+        size_t semi = amp + 1;
+        while (semi < limit && text[semi] != ';') semi++;
+        if (semi < limit && semi > amp + 1) {
+            string_view name = text.substr(amp + 1, semi - amp - 1);
+            consumed = semi - amp + 1;
+
+            if (name[0] == '#') return decodeNumeric(name.substr(1), out);
+            if (char c = xmlEntity(name)) {
+                out[0] = c;
+                return 1;
+            }
+            if (xmlOnly) return 0;
+
+            if (const Entity* entity = lookup(name)) {
+                memcpy(out, entity->utf8.data(), entity->utf8.size());
+                return entity->utf8.size();
+            }
+        }
+        return xmlOnly ? 0 : decodeLegacy(text, amp, out, consumed);
+    }
+
+    static constexpr bool isValid() {
+        for (size_t i = 0; i < size(kEntities); i++) {
+            if (i > 0 && !(kEntities[i - 1].name < kEntities[i].name)) return false;
+            if (kEntities[i].utf8.size() > kEntities[i].name.size() + 2) return false;
+            if (kEntities[i].utf8.size() > kMaxUTF8 || kEntities[i].name.size() + 1 > kMaxLength) return false;
+        }
+        // Without the ';', a legacy name has one byte less to decode into
+        for (size_t i = 0; i < size(kLegacy); i++) {
+            if (i > 0 && !(kLegacy[i - 1] < kLegacy[i])) return false;
+            const Entity* entity = lookup(kLegacy[i]);
+            if (!entity || entity->utf8.size() > kLegacy[i].size() + 1 || kLegacy[i].size() > kMaxLegacyLength) return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t kMaxLength = 32;   // the longest name, CounterClockwiseContourIntegral, and its ';'
+    static constexpr size_t kMaxLegacyLength = 6;
+
+    static constexpr const Entity* lookup(string_view name) {
+        size_t low = 0, high = size(kEntities);
+        while (low < high) {
+            size_t mid = (low + high) / 2;
+            if (kEntities[mid].name < name) low = mid + 1;
+            else high = mid;
+        }
+        return low < size(kEntities) && kEntities[low].name == name ? &kEntities[low] : nullptr;
+    }
+
+    // A reference with no ';' (or none that names an entity): the longest
+    // legacy name the text starts with, as HTML reads text. "&copy2024" is
+    // "©2024" and "&notit;" is "¬it;".
+    static size_t decodeLegacy(string_view text, size_t amp, char* out, size_t& consumed) {
+        string_view rest = text.substr(amp + 1, kMaxLegacyLength);
+        if (rest.empty() || !isalpha((unsigned char)rest[0])) return 0;
+        for (size_t length = rest.size(); length >= 2; length--) {
+            string_view name = rest.substr(0, length);
+            if (!binary_search(begin(kLegacy), end(kLegacy), name)) continue;
+            const Entity* entity = lookup(name);
+            memcpy(out, entity->utf8.data(), entity->utf8.size());
+            consumed = length + 1;
+            return entity->utf8.size();
+        }
+        return 0;
+    }
+
+    // HTML5's legacy names, sorted; their expansions are those of the ';' forms
+    static constexpr string_view kLegacy[] = {
+        "AElig", "AMP", "Aacute", "Acirc", "Agrave", "Aring", "Atilde", "Auml", "COPY", "Ccedil", "ETH", "Eacute",
+        "Ecirc", "Egrave", "Euml", "GT", "Iacute", "Icirc", "Igrave", "Iuml", "LT", "Ntilde", "Oacute", "Ocirc",
+        "Ograve", "Oslash", "Otilde", "Ouml", "QUOT", "REG", "THORN", "Uacute", "Ucirc", "Ugrave", "Uuml", "Yacute",
+        "aacute", "acirc", "acute", "aelig", "agrave", "amp", "aring", "atilde", "auml", "brvbar", "ccedil", "cedil",
+        "cent", "copy", "curren", "deg", "divide", "eacute", "ecirc", "egrave", "eth", "euml", "frac12", "frac14",
+        "frac34", "gt", "iacute", "icirc", "iexcl", "igrave", "iquest", "iuml", "laquo", "lt", "macr", "micro",
+        "middot", "nbsp", "not", "ntilde", "oacute", "ocirc", "ograve", "ordf", "ordm", "oslash", "otilde", "ouml",
+        "para", "plusmn", "pound", "quot", "raquo", "reg", "sect", "shy", "sup1", "sup2", "sup3", "szlig", "thorn",
+        "times", "uacute", "ucirc", "ugrave", "uml", "uuml", "yacute", "yen", "yuml",
+    };
+
+    // The five XML references, which are also by far the most common in HTML
+    static char xmlEntity(string_view name) {
+        switch (name.size()) {
+        case 2:
+            if (name[1] != 't') return 0;
+            return name[0] == 'l' ? '<' : name[0] == 'g' ? '>' : 0;
+        case 3:
+            return name == "amp" ? '&' : 0;
+        case 4:
+            return name == "quot" ? '"' : name == "apos" ? '\'' : 0;
+        default:
+            return 0;
+        }
+    }
+
+    // &#NNN; / &#xHHH;. C1 controls are read as windows-1252, as browsers do;
+    // C0 controls other than tab, LF and CR, DEL, and anything that is not a
+    // scalar value become U+FFFD.
+    static size_t decodeNumeric(string_view digits, char* out) {
+        bool hex = !digits.empty() && (digits[0] == 'x' || digits[0] == 'X');
+        if (hex) digits.remove_prefix(1);
+        if (digits.empty()) return 0;
+
+        uint32_t cp = 0;
+        for (char c : digits) {
+            uint32_t d;
+            if (c >= '0' && c <= '9') d = c - '0';
+            else if (hex && c >= 'a' && c <= 'f') d = c - 'a' + 10;
+            else if (hex && c >= 'A' && c <= 'F') d = c - 'A' + 10;
+            else return 0;
+            cp = cp * (hex ? 16 : 10) + d;
+            if (cp > 0x10FFFF) break;
+        }
+
+        if (cp >= 0x80 && cp <= 0x9F) cp = TextEncoding::fromWindows1252((uint8_t)cp);
+        bool control = (cp < 0x20 && cp != '\t' && cp != '\n' && cp != '\r') || cp == 0x7F;
+        if (control || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+        return TextEncoding::encodeUTF8(cp, out);
+    }
+
+    static constexpr Entity kEntities[] = {
+        { "AElig", "\xC3\x86" }, { "AMP", "\x26" }, { "Aacute", "\xC3\x81" }, { "Abreve", "\xC4\x82" },
+        { "Acirc", "\xC3\x82" }, { "Acy", "\xD0\x90" }, { "Afr", "\xF0\x9D\x94\x84" }, { "Agrave", "\xC3\x80" },
+        { "Alpha", "\xCE\x91" }, { "Amacr", "\xC4\x80" }, { "And", "\xE2\xA9\x93" }, { "Aogon", "\xC4\x84" },
+        { "Aopf", "\xF0\x9D\x94\xB8" }, { "ApplyFunction", "\xE2\x81\xA1" }, { "Aring", "\xC3\x85" },
+        { "Ascr", "\xF0\x9D\x92\x9C" }, { "Assign", "\xE2\x89\x94" }, { "Atilde", "\xC3\x83" }, { "Auml", "\xC3\x84" },
+        { "Backslash", "\xE2\x88\x96" }, { "Barv", "\xE2\xAB\xA7" }, { "Barwed", "\xE2\x8C\x86" },
+        { "Bcy", "\xD0\x91" }, { "Because", "\xE2\x88\xB5" }, { "Bernoullis", "\xE2\x84\xAC" }, { "Beta", "\xCE\x92" },
+        { "Bfr", "\xF0\x9D\x94\x85" }, { "Bopf", "\xF0\x9D\x94\xB9" }, { "Breve", "\xCB\x98" },
+        { "Bscr", "\xE2\x84\xAC" }, { "Bumpeq", "\xE2\x89\x8E" }, { "CHcy", "\xD0\xA7" }, { "COPY", "\xC2\xA9" },
+        { "Cacute", "\xC4\x86" }, { "Cap", "\xE2\x8B\x92" }, { "CapitalDifferentialD", "\xE2\x85\x85" },
+        { "Cayleys", "\xE2\x84\xAD" }, { "Ccaron", "\xC4\x8C" }, { "Ccedil", "\xC3\x87" }, { "Ccirc", "\xC4\x88" },
+        { "Cconint", "\xE2\x88\xB0" }, { "Cdot", "\xC4\x8A" }, { "Cedilla", "\xC2\xB8" }, { "CenterDot", "\xC2\xB7" },
+        { "Cfr", "\xE2\x84\xAD" }, { "Chi", "\xCE\xA7" }, { "CircleDot", "\xE2\x8A\x99" },
+        { "CircleMinus", "\xE2\x8A\x96" }, { "CirclePlus", "\xE2\x8A\x95" }, { "CircleTimes", "\xE2\x8A\x97" },
+        { "ClockwiseContourIntegral", "\xE2\x88\xB2" }, { "CloseCurlyDoubleQuote", "\xE2\x80\x9D" },
+        { "CloseCurlyQuote", "\xE2\x80\x99" }, { "Colon", "\xE2\x88\xB7" }, { "Colone", "\xE2\xA9\xB4" },
+        { "Congruent", "\xE2\x89\xA1" }, { "Conint", "\xE2\x88\xAF" }, { "ContourIntegral", "\xE2\x88\xAE" },
+        { "Copf", "\xE2\x84\x82" }, { "Coproduct", "\xE2\x88\x90" },
+        { "CounterClockwiseContourIntegral", "\xE2\x88\xB3" }, { "Cross", "\xE2\xA8\xAF" },
+        { "Cscr", "\xF0\x9D\x92\x9E" }, { "Cup", "\xE2\x8B\x93" }, { "CupCap", "\xE2\x89\x8D" },
+        { "DD", "\xE2\x85\x85" }, { "DDotrahd", "\xE2\xA4\x91" }, { "DJcy", "\xD0\x82" }, { "DScy", "\xD0\x85" },
+        { "DZcy", "\xD0\x8F" }, { "Dagger", "\xE2\x80\xA1" }, { "Darr", "\xE2\x86\xA1" }, { "Dashv", "\xE2\xAB\xA4" },
+        { "Dcaron", "\xC4\x8E" }, { "Dcy", "\xD0\x94" }, { "Del", "\xE2\x88\x87" }, { "Delta", "\xCE\x94" },
+        { "Dfr", "\xF0\x9D\x94\x87" }, { "DiacriticalAcute", "\xC2\xB4" }, { "DiacriticalDot", "\xCB\x99" },
+        { "DiacriticalDoubleAcute", "\xCB\x9D" }, { "DiacriticalGrave", "\x60" }, { "DiacriticalTilde", "\xCB\x9C" },
+        { "Diamond", "\xE2\x8B\x84" }, { "DifferentialD", "\xE2\x85\x86" }, { "Dopf", "\xF0\x9D\x94\xBB" },
+        { "Dot", "\xC2\xA8" }, { "DotDot", "\xE2\x83\x9C" }, { "DotEqual", "\xE2\x89\x90" },
+        { "DoubleContourIntegral", "\xE2\x88\xAF" }, { "DoubleDot", "\xC2\xA8" }, { "DoubleDownArrow", "\xE2\x87\x93" },
+        { "DoubleLeftArrow", "\xE2\x87\x90" }, { "DoubleLeftRightArrow", "\xE2\x87\x94" },
+        { "DoubleLeftTee", "\xE2\xAB\xA4" }, { "DoubleLongLeftArrow", "\xE2\x9F\xB8" },
+        { "DoubleLongLeftRightArrow", "\xE2\x9F\xBA" }, { "DoubleLongRightArrow", "\xE2\x9F\xB9" },
+        { "DoubleRightArrow", "\xE2\x87\x92" }, { "DoubleRightTee", "\xE2\x8A\xA8" },
+        { "DoubleUpArrow", "\xE2\x87\x91" }, { "DoubleUpDownArrow", "\xE2\x87\x95" },
+        { "DoubleVerticalBar", "\xE2\x88\xA5" }, { "DownArrow", "\xE2\x86\x93" }, { "DownArrowBar", "\xE2\xA4\x93" },
+        { "DownArrowUpArrow", "\xE2\x87\xB5" }, { "DownBreve", "\xCC\x91" }, { "DownLeftRightVector", "\xE2\xA5\x90" },
+        { "DownLeftTeeVector", "\xE2\xA5\x9E" }, { "DownLeftVector", "\xE2\x86\xBD" },
+        { "DownLeftVectorBar", "\xE2\xA5\x96" }, { "DownRightTeeVector", "\xE2\xA5\x9F" },
+        { "DownRightVector", "\xE2\x87\x81" }, { "DownRightVectorBar", "\xE2\xA5\x97" }, { "DownTee", "\xE2\x8A\xA4" },
+        { "DownTeeArrow", "\xE2\x86\xA7" }, { "Downarrow", "\xE2\x87\x93" }, { "Dscr", "\xF0\x9D\x92\x9F" },
+        { "Dstrok", "\xC4\x90" }, { "ENG", "\xC5\x8A" }, { "ETH", "\xC3\x90" }, { "Eacute", "\xC3\x89" },
+        { "Ecaron", "\xC4\x9A" }, { "Ecirc", "\xC3\x8A" }, { "Ecy", "\xD0\xAD" }, { "Edot", "\xC4\x96" },
+        { "Efr", "\xF0\x9D\x94\x88" }, { "Egrave", "\xC3\x88" }, { "Element", "\xE2\x88\x88" }, { "Emacr", "\xC4\x92" },
+        { "EmptySmallSquare", "\xE2\x97\xBB" }, { "EmptyVerySmallSquare", "\xE2\x96\xAB" }, { "Eogon", "\xC4\x98" },
+        { "Eopf", "\xF0\x9D\x94\xBC" }, { "Epsilon", "\xCE\x95" }, { "Equal", "\xE2\xA9\xB5" },
+        { "EqualTilde", "\xE2\x89\x82" }, { "Equilibrium", "\xE2\x87\x8C" }, { "Escr", "\xE2\x84\xB0" },
+        { "Esim", "\xE2\xA9\xB3" }, { "Eta", "\xCE\x97" }, { "Euml", "\xC3\x8B" }, { "Exists", "\xE2\x88\x83" },
+        { "ExponentialE", "\xE2\x85\x87" }, { "Fcy", "\xD0\xA4" }, { "Ffr", "\xF0\x9D\x94\x89" },
+        { "FilledSmallSquare", "\xE2\x97\xBC" }, { "FilledVerySmallSquare", "\xE2\x96\xAA" },
+        { "Fopf", "\xF0\x9D\x94\xBD" }, { "ForAll", "\xE2\x88\x80" }, { "Fouriertrf", "\xE2\x84\xB1" },
+        { "Fscr", "\xE2\x84\xB1" }, { "GJcy", "\xD0\x83" }, { "GT", "\x3E" }, { "Gamma", "\xCE\x93" },
+        { "Gammad", "\xCF\x9C" }, { "Gbreve", "\xC4\x9E" }, { "Gcedil", "\xC4\xA2" }, { "Gcirc", "\xC4\x9C" },
+        { "Gcy", "\xD0\x93" }, { "Gdot", "\xC4\xA0" }, { "Gfr", "\xF0\x9D\x94\x8A" }, { "Gg", "\xE2\x8B\x99" },
+        { "Gopf", "\xF0\x9D\x94\xBE" }, { "GreaterEqual", "\xE2\x89\xA5" }, { "GreaterEqualLess", "\xE2\x8B\x9B" },
+        { "GreaterFullEqual", "\xE2\x89\xA7" }, { "GreaterGreater", "\xE2\xAA\xA2" }, { "GreaterLess", "\xE2\x89\xB7" },
+        { "GreaterSlantEqual", "\xE2\xA9\xBE" }, { "GreaterTilde", "\xE2\x89\xB3" }, { "Gscr", "\xF0\x9D\x92\xA2" },
+        { "Gt", "\xE2\x89\xAB" }, { "HARDcy", "\xD0\xAA" }, { "Hacek", "\xCB\x87" }, { "Hat", "\x5E" },
+        { "Hcirc", "\xC4\xA4" }, { "Hfr", "\xE2\x84\x8C" }, { "HilbertSpace", "\xE2\x84\x8B" },
+        { "Hopf", "\xE2\x84\x8D" }, { "HorizontalLine", "\xE2\x94\x80" }, { "Hscr", "\xE2\x84\x8B" },
+        { "Hstrok", "\xC4\xA6" }, { "HumpDownHump", "\xE2\x89\x8E" }, { "HumpEqual", "\xE2\x89\x8F" },
+        { "IEcy", "\xD0\x95" }, { "IJlig", "\xC4\xB2" }, { "IOcy", "\xD0\x81" }, { "Iacute", "\xC3\x8D" },
+        { "Icirc", "\xC3\x8E" }, { "Icy", "\xD0\x98" }, { "Idot", "\xC4\xB0" }, { "Ifr", "\xE2\x84\x91" },
+        { "Igrave", "\xC3\x8C" }, { "Im", "\xE2\x84\x91" }, { "Imacr", "\xC4\xAA" }, { "ImaginaryI", "\xE2\x85\x88" },
+        { "Implies", "\xE2\x87\x92" }, { "Int", "\xE2\x88\xAC" }, { "Integral", "\xE2\x88\xAB" },
+        { "Intersection", "\xE2\x8B\x82" }, { "InvisibleComma", "\xE2\x81\xA3" }, { "InvisibleTimes", "\xE2\x81\xA2" },
+        { "Iogon", "\xC4\xAE" }, { "Iopf", "\xF0\x9D\x95\x80" }, { "Iota", "\xCE\x99" }, { "Iscr", "\xE2\x84\x90" },
+        { "Itilde", "\xC4\xA8" }, { "Iukcy", "\xD0\x86" }, { "Iuml", "\xC3\x8F" }, { "Jcirc", "\xC4\xB4" },
+        { "Jcy", "\xD0\x99" }, { "Jfr", "\xF0\x9D\x94\x8D" }, { "Jopf", "\xF0\x9D\x95\x81" },
+        { "Jscr", "\xF0\x9D\x92\xA5" }, { "Jsercy", "\xD0\x88" }, { "Jukcy", "\xD0\x84" }, { "KHcy", "\xD0\xA5" },
+        { "KJcy", "\xD0\x8C" }, { "Kappa", "\xCE\x9A" }, { "Kcedil", "\xC4\xB6" }, { "Kcy", "\xD0\x9A" },
+        { "Kfr", "\xF0\x9D\x94\x8E" }, { "Kopf", "\xF0\x9D\x95\x82" }, { "Kscr", "\xF0\x9D\x92\xA6" },
+        { "LJcy", "\xD0\x89" }, { "LT", "\x3C" }, { "Lacute", "\xC4\xB9" }, { "Lambda", "\xCE\x9B" },
+        { "Lang", "\xE2\x9F\xAA" }, { "Laplacetrf", "\xE2\x84\x92" }, { "Larr", "\xE2\x86\x9E" },
+        { "Lcaron", "\xC4\xBD" }, { "Lcedil", "\xC4\xBB" }, { "Lcy", "\xD0\x9B" },
+        { "LeftAngleBracket", "\xE2\x9F\xA8" }, { "LeftArrow", "\xE2\x86\x90" }, { "LeftArrowBar", "\xE2\x87\xA4" },
+        { "LeftArrowRightArrow", "\xE2\x87\x86" }, { "LeftCeiling", "\xE2\x8C\x88" },
+        { "LeftDoubleBracket", "\xE2\x9F\xA6" }, { "LeftDownTeeVector", "\xE2\xA5\xA1" },
+        { "LeftDownVector", "\xE2\x87\x83" }, { "LeftDownVectorBar", "\xE2\xA5\x99" }, { "LeftFloor", "\xE2\x8C\x8A" },
+        { "LeftRightArrow", "\xE2\x86\x94" }, { "LeftRightVector", "\xE2\xA5\x8E" }, { "LeftTee", "\xE2\x8A\xA3" },
+        { "LeftTeeArrow", "\xE2\x86\xA4" }, { "LeftTeeVector", "\xE2\xA5\x9A" }, { "LeftTriangle", "\xE2\x8A\xB2" },
+        { "LeftTriangleBar", "\xE2\xA7\x8F" }, { "LeftTriangleEqual", "\xE2\x8A\xB4" },
+        { "LeftUpDownVector", "\xE2\xA5\x91" }, { "LeftUpTeeVector", "\xE2\xA5\xA0" },
+        { "LeftUpVector", "\xE2\x86\xBF" }, { "LeftUpVectorBar", "\xE2\xA5\x98" }, { "LeftVector", "\xE2\x86\xBC" },
+        { "LeftVectorBar", "\xE2\xA5\x92" }, { "Leftarrow", "\xE2\x87\x90" }, { "Leftrightarrow", "\xE2\x87\x94" },
+        { "LessEqualGreater", "\xE2\x8B\x9A" }, { "LessFullEqual", "\xE2\x89\xA6" }, { "LessGreater", "\xE2\x89\xB6" },
+        { "LessLess", "\xE2\xAA\xA1" }, { "LessSlantEqual", "\xE2\xA9\xBD" }, { "LessTilde", "\xE2\x89\xB2" },
+        { "Lfr", "\xF0\x9D\x94\x8F" }, { "Ll", "\xE2\x8B\x98" }, { "Lleftarrow", "\xE2\x87\x9A" },
+        { "Lmidot", "\xC4\xBF" }, { "LongLeftArrow", "\xE2\x9F\xB5" }, { "LongLeftRightArrow", "\xE2\x9F\xB7" },
+        { "LongRightArrow", "\xE2\x9F\xB6" }, { "Longleftarrow", "\xE2\x9F\xB8" },
+        { "Longleftrightarrow", "\xE2\x9F\xBA" }, { "Longrightarrow", "\xE2\x9F\xB9" }, { "Lopf", "\xF0\x9D\x95\x83" },
+        { "LowerLeftArrow", "\xE2\x86\x99" }, { "LowerRightArrow", "\xE2\x86\x98" }, { "Lscr", "\xE2\x84\x92" },
+        { "Lsh", "\xE2\x86\xB0" }, { "Lstrok", "\xC5\x81" }, { "Lt", "\xE2\x89\xAA" }, { "Map", "\xE2\xA4\x85" },
+        { "Mcy", "\xD0\x9C" }, { "MediumSpace", "\xE2\x81\x9F" }, { "Mellintrf", "\xE2\x84\xB3" },
+        { "Mfr", "\xF0\x9D\x94\x90" }, { "MinusPlus", "\xE2\x88\x93" }, { "Mopf", "\xF0\x9D\x95\x84" },
+        { "Mscr", "\xE2\x84\xB3" }, { "Mu", "\xCE\x9C" }, { "NJcy", "\xD0\x8A" }, { "Nacute", "\xC5\x83" },
+        { "Ncaron", "\xC5\x87" }, { "Ncedil", "\xC5\x85" }, { "Ncy", "\xD0\x9D" },
+        { "NegativeMediumSpace", "\xE2\x80\x8B" }, { "NegativeThickSpace", "\xE2\x80\x8B" },
+        { "NegativeThinSpace", "\xE2\x80\x8B" }, { "NegativeVeryThinSpace", "\xE2\x80\x8B" },
+        { "NestedGreaterGreater", "\xE2\x89\xAB" }, { "NestedLessLess", "\xE2\x89\xAA" }, { "NewLine", "\x0A" },
+        { "Nfr", "\xF0\x9D\x94\x91" }, { "NoBreak", "\xE2\x81\xA0" }, { "NonBreakingSpace", "\xC2\xA0" },
+        { "Nopf", "\xE2\x84\x95" }, { "Not", "\xE2\xAB\xAC" }, { "NotCongruent", "\xE2\x89\xA2" },
+        { "NotCupCap", "\xE2\x89\xAD" }, { "NotDoubleVerticalBar", "\xE2\x88\xA6" }, { "NotElement", "\xE2\x88\x89" },
+        { "NotEqual", "\xE2\x89\xA0" }, { "NotEqualTilde", "\xE2\x89\x82\xCC\xB8" }, { "NotExists", "\xE2\x88\x84" },
+        { "NotGreater", "\xE2\x89\xAF" }, { "NotGreaterEqual", "\xE2\x89\xB1" },
+        { "NotGreaterFullEqual", "\xE2\x89\xA7\xCC\xB8" }, { "NotGreaterGreater", "\xE2\x89\xAB\xCC\xB8" },
+        { "NotGreaterLess", "\xE2\x89\xB9" }, { "NotGreaterSlantEqual", "\xE2\xA9\xBE\xCC\xB8" },
+        { "NotGreaterTilde", "\xE2\x89\xB5" }, { "NotHumpDownHump", "\xE2\x89\x8E\xCC\xB8" },
+        { "NotHumpEqual", "\xE2\x89\x8F\xCC\xB8" }, { "NotLeftTriangle", "\xE2\x8B\xAA" },
+        { "NotLeftTriangleBar", "\xE2\xA7\x8F\xCC\xB8" }, { "NotLeftTriangleEqual", "\xE2\x8B\xAC" },
+        { "NotLess", "\xE2\x89\xAE" }, { "NotLessEqual", "\xE2\x89\xB0" }, { "NotLessGreater", "\xE2\x89\xB8" },
+        { "NotLessLess", "\xE2\x89\xAA\xCC\xB8" }, { "NotLessSlantEqual", "\xE2\xA9\xBD\xCC\xB8" },
+        { "NotLessTilde", "\xE2\x89\xB4" }, { "NotNestedGreaterGreater", "\xE2\xAA\xA2\xCC\xB8" },
+        { "NotNestedLessLess", "\xE2\xAA\xA1\xCC\xB8" }, { "NotPrecedes", "\xE2\x8A\x80" },
+        { "NotPrecedesEqual", "\xE2\xAA\xAF\xCC\xB8" }, { "NotPrecedesSlantEqual", "\xE2\x8B\xA0" },
+        { "NotReverseElement", "\xE2\x88\x8C" }, { "NotRightTriangle", "\xE2\x8B\xAB" },
+        { "NotRightTriangleBar", "\xE2\xA7\x90\xCC\xB8" }, { "NotRightTriangleEqual", "\xE2\x8B\xAD" },
+        { "NotSquareSubset", "\xE2\x8A\x8F\xCC\xB8" }, { "NotSquareSubsetEqual", "\xE2\x8B\xA2" },
+        { "NotSquareSuperset", "\xE2\x8A\x90\xCC\xB8" }, { "NotSquareSupersetEqual", "\xE2\x8B\xA3" },
+        { "NotSubset", "\xE2\x8A\x82\xE2\x83\x92" }, { "NotSubsetEqual", "\xE2\x8A\x88" },
+        { "NotSucceeds", "\xE2\x8A\x81" }, { "NotSucceedsEqual", "\xE2\xAA\xB0\xCC\xB8" },
+        { "NotSucceedsSlantEqual", "\xE2\x8B\xA1" }, { "NotSucceedsTilde", "\xE2\x89\xBF\xCC\xB8" },
+        { "NotSuperset", "\xE2\x8A\x83\xE2\x83\x92" }, { "NotSupersetEqual", "\xE2\x8A\x89" },
+        { "NotTilde", "\xE2\x89\x81" }, { "NotTildeEqual", "\xE2\x89\x84" }, { "NotTildeFullEqual", "\xE2\x89\x87" },
+        { "NotTildeTilde", "\xE2\x89\x89" }, { "NotVerticalBar", "\xE2\x88\xA4" }, { "Nscr", "\xF0\x9D\x92\xA9" },
+        { "Ntilde", "\xC3\x91" }, { "Nu", "\xCE\x9D" }, { "OElig", "\xC5\x92" }, { "Oacute", "\xC3\x93" },
+        { "Ocirc", "\xC3\x94" }, { "Ocy", "\xD0\x9E" }, { "Odblac", "\xC5\x90" }, { "Ofr", "\xF0\x9D\x94\x92" },
+        { "Ograve", "\xC3\x92" }, { "Omacr", "\xC5\x8C" }, { "Omega", "\xCE\xA9" }, { "Omicron", "\xCE\x9F" },
+        { "Oopf", "\xF0\x9D\x95\x86" }, { "OpenCurlyDoubleQuote", "\xE2\x80\x9C" },
+        { "OpenCurlyQuote", "\xE2\x80\x98" }, { "Or", "\xE2\xA9\x94" }, { "Oscr", "\xF0\x9D\x92\xAA" },
+        { "Oslash", "\xC3\x98" }, { "Otilde", "\xC3\x95" }, { "Otimes", "\xE2\xA8\xB7" }, { "Ouml", "\xC3\x96" },
+        { "OverBar", "\xE2\x80\xBE" }, { "OverBrace", "\xE2\x8F\x9E" }, { "OverBracket", "\xE2\x8E\xB4" },
+        { "OverParenthesis", "\xE2\x8F\x9C" }, { "PartialD", "\xE2\x88\x82" }, { "Pcy", "\xD0\x9F" },
+        { "Pfr", "\xF0\x9D\x94\x93" }, { "Phi", "\xCE\xA6" }, { "Pi", "\xCE\xA0" }, { "PlusMinus", "\xC2\xB1" },
+        { "Poincareplane", "\xE2\x84\x8C" }, { "Popf", "\xE2\x84\x99" }, { "Pr", "\xE2\xAA\xBB" },
+        { "Precedes", "\xE2\x89\xBA" }, { "PrecedesEqual", "\xE2\xAA\xAF" }, { "PrecedesSlantEqual", "\xE2\x89\xBC" },
+        { "PrecedesTilde", "\xE2\x89\xBE" }, { "Prime", "\xE2\x80\xB3" }, { "Product", "\xE2\x88\x8F" },
+        { "Proportion", "\xE2\x88\xB7" }, { "Proportional", "\xE2\x88\x9D" }, { "Pscr", "\xF0\x9D\x92\xAB" },
+        { "Psi", "\xCE\xA8" }, { "QUOT", "\x22" }, { "Qfr", "\xF0\x9D\x94\x94" }, { "Qopf", "\xE2\x84\x9A" },
+        { "Qscr", "\xF0\x9D\x92\xAC" }, { "RBarr", "\xE2\xA4\x90" }, { "REG", "\xC2\xAE" }, { "Racute", "\xC5\x94" },
+        { "Rang", "\xE2\x9F\xAB" }, { "Rarr", "\xE2\x86\xA0" }, { "Rarrtl", "\xE2\xA4\x96" }, { "Rcaron", "\xC5\x98" },
+        { "Rcedil", "\xC5\x96" }, { "Rcy", "\xD0\xA0" }, { "Re", "\xE2\x84\x9C" }, { "ReverseElement", "\xE2\x88\x8B" },
+        { "ReverseEquilibrium", "\xE2\x87\x8B" }, { "ReverseUpEquilibrium", "\xE2\xA5\xAF" }, { "Rfr", "\xE2\x84\x9C" },
+        { "Rho", "\xCE\xA1" }, { "RightAngleBracket", "\xE2\x9F\xA9" }, { "RightArrow", "\xE2\x86\x92" },
+        { "RightArrowBar", "\xE2\x87\xA5" }, { "RightArrowLeftArrow", "\xE2\x87\x84" },
+        { "RightCeiling", "\xE2\x8C\x89" }, { "RightDoubleBracket", "\xE2\x9F\xA7" },
+        { "RightDownTeeVector", "\xE2\xA5\x9D" }, { "RightDownVector", "\xE2\x87\x82" },
+        { "RightDownVectorBar", "\xE2\xA5\x95" }, { "RightFloor", "\xE2\x8C\x8B" }, { "RightTee", "\xE2\x8A\xA2" },
+        { "RightTeeArrow", "\xE2\x86\xA6" }, { "RightTeeVector", "\xE2\xA5\x9B" }, { "RightTriangle", "\xE2\x8A\xB3" },
+        { "RightTriangleBar", "\xE2\xA7\x90" }, { "RightTriangleEqual", "\xE2\x8A\xB5" },
+        { "RightUpDownVector", "\xE2\xA5\x8F" }, { "RightUpTeeVector", "\xE2\xA5\x9C" },
+        { "RightUpVector", "\xE2\x86\xBE" }, { "RightUpVectorBar", "\xE2\xA5\x94" }, { "RightVector", "\xE2\x87\x80" },
+        { "RightVectorBar", "\xE2\xA5\x93" }, { "Rightarrow", "\xE2\x87\x92" }, { "Ropf", "\xE2\x84\x9D" },
+        { "RoundImplies", "\xE2\xA5\xB0" }, { "Rrightarrow", "\xE2\x87\x9B" }, { "Rscr", "\xE2\x84\x9B" },
+        { "Rsh", "\xE2\x86\xB1" }, { "RuleDelayed", "\xE2\xA7\xB4" }, { "SHCHcy", "\xD0\xA9" }, { "SHcy", "\xD0\xA8" },
+        { "SOFTcy", "\xD0\xAC" }, { "Sacute", "\xC5\x9A" }, { "Sc", "\xE2\xAA\xBC" }, { "Scaron", "\xC5\xA0" },
+        { "Scedil", "\xC5\x9E" }, { "Scirc", "\xC5\x9C" }, { "Scy", "\xD0\xA1" }, { "Sfr", "\xF0\x9D\x94\x96" },
+        { "ShortDownArrow", "\xE2\x86\x93" }, { "ShortLeftArrow", "\xE2\x86\x90" },
+        { "ShortRightArrow", "\xE2\x86\x92" }, { "ShortUpArrow", "\xE2\x86\x91" }, { "Sigma", "\xCE\xA3" },
+        { "SmallCircle", "\xE2\x88\x98" }, { "Sopf", "\xF0\x9D\x95\x8A" }, { "Sqrt", "\xE2\x88\x9A" },
+        { "Square", "\xE2\x96\xA1" }, { "SquareIntersection", "\xE2\x8A\x93" }, { "SquareSubset", "\xE2\x8A\x8F" },
+        { "SquareSubsetEqual", "\xE2\x8A\x91" }, { "SquareSuperset", "\xE2\x8A\x90" },
+        { "SquareSupersetEqual", "\xE2\x8A\x92" }, { "SquareUnion", "\xE2\x8A\x94" }, { "Sscr", "\xF0\x9D\x92\xAE" },
+        { "Star", "\xE2\x8B\x86" }, { "Sub", "\xE2\x8B\x90" }, { "Subset", "\xE2\x8B\x90" },
+        { "SubsetEqual", "\xE2\x8A\x86" }, { "Succeeds", "\xE2\x89\xBB" }, { "SucceedsEqual", "\xE2\xAA\xB0" },
+        { "SucceedsSlantEqual", "\xE2\x89\xBD" }, { "SucceedsTilde", "\xE2\x89\xBF" }, { "SuchThat", "\xE2\x88\x8B" },
+        { "Sum", "\xE2\x88\x91" }, { "Sup", "\xE2\x8B\x91" }, { "Superset", "\xE2\x8A\x83" },
+        { "SupersetEqual", "\xE2\x8A\x87" }, { "Supset", "\xE2\x8B\x91" }, { "THORN", "\xC3\x9E" },
+        { "TRADE", "\xE2\x84\xA2" }, { "TSHcy", "\xD0\x8B" }, { "TScy", "\xD0\xA6" }, { "Tab", "\x09" },
+        { "Tau", "\xCE\xA4" }, { "Tcaron", "\xC5\xA4" }, { "Tcedil", "\xC5\xA2" }, { "Tcy", "\xD0\xA2" },
+        { "Tfr", "\xF0\x9D\x94\x97" }, { "Therefore", "\xE2\x88\xB4" }, { "Theta", "\xCE\x98" },
+        { "ThickSpace", "\xE2\x81\x9F\xE2\x80\x8A" }, { "ThinSpace", "\xE2\x80\x89" }, { "Tilde", "\xE2\x88\xBC" },
+        { "TildeEqual", "\xE2\x89\x83" }, { "TildeFullEqual", "\xE2\x89\x85" }, { "TildeTilde", "\xE2\x89\x88" },
+        { "Topf", "\xF0\x9D\x95\x8B" }, { "TripleDot", "\xE2\x83\x9B" }, { "Tscr", "\xF0\x9D\x92\xAF" },
+        { "Tstrok", "\xC5\xA6" }, { "Uacute", "\xC3\x9A" }, { "Uarr", "\xE2\x86\x9F" }, { "Uarrocir", "\xE2\xA5\x89" },
+        { "Ubrcy", "\xD0\x8E" }, { "Ubreve", "\xC5\xAC" }, { "Ucirc", "\xC3\x9B" }, { "Ucy", "\xD0\xA3" },
+        { "Udblac", "\xC5\xB0" }, { "Ufr", "\xF0\x9D\x94\x98" }, { "Ugrave", "\xC3\x99" }, { "Umacr", "\xC5\xAA" },
+        { "UnderBar", "\x5F" }, { "UnderBrace", "\xE2\x8F\x9F" }, { "UnderBracket", "\xE2\x8E\xB5" },
+        { "UnderParenthesis", "\xE2\x8F\x9D" }, { "Union", "\xE2\x8B\x83" }, { "UnionPlus", "\xE2\x8A\x8E" },
+        { "Uogon", "\xC5\xB2" }, { "Uopf", "\xF0\x9D\x95\x8C" }, { "UpArrow", "\xE2\x86\x91" },
+        { "UpArrowBar", "\xE2\xA4\x92" }, { "UpArrowDownArrow", "\xE2\x87\x85" }, { "UpDownArrow", "\xE2\x86\x95" },
+        { "UpEquilibrium", "\xE2\xA5\xAE" }, { "UpTee", "\xE2\x8A\xA5" }, { "UpTeeArrow", "\xE2\x86\xA5" },
+        { "Uparrow", "\xE2\x87\x91" }, { "Updownarrow", "\xE2\x87\x95" }, { "UpperLeftArrow", "\xE2\x86\x96" },
+        { "UpperRightArrow", "\xE2\x86\x97" }, { "Upsi", "\xCF\x92" }, { "Upsilon", "\xCE\xA5" },
+        { "Uring", "\xC5\xAE" }, { "Uscr", "\xF0\x9D\x92\xB0" }, { "Utilde", "\xC5\xA8" }, { "Uuml", "\xC3\x9C" },
+        { "VDash", "\xE2\x8A\xAB" }, { "Vbar", "\xE2\xAB\xAB" }, { "Vcy", "\xD0\x92" }, { "Vdash", "\xE2\x8A\xA9" },
+        { "Vdashl", "\xE2\xAB\xA6" }, { "Vee", "\xE2\x8B\x81" }, { "Verbar", "\xE2\x80\x96" },
+        { "Vert", "\xE2\x80\x96" }, { "VerticalBar", "\xE2\x88\xA3" }, { "VerticalLine", "\x7C" },
+        { "VerticalSeparator", "\xE2\x9D\x98" }, { "VerticalTilde", "\xE2\x89\x80" },
+        { "VeryThinSpace", "\xE2\x80\x8A" }, { "Vfr", "\xF0\x9D\x94\x99" }, { "Vopf", "\xF0\x9D\x95\x8D" },
+        { "Vscr", "\xF0\x9D\x92\xB1" }, { "Vvdash", "\xE2\x8A\xAA" }, { "Wcirc", "\xC5\xB4" },
+        { "Wedge", "\xE2\x8B\x80" }, { "Wfr", "\xF0\x9D\x94\x9A" }, { "Wopf", "\xF0\x9D\x95\x8E" },
+        { "Wscr", "\xF0\x9D\x92\xB2" }, { "Xfr", "\xF0\x9D\x94\x9B" }, { "Xi", "\xCE\x9E" },
+        { "Xopf", "\xF0\x9D\x95\x8F" }, { "Xscr", "\xF0\x9D\x92\xB3" }, { "YAcy", "\xD0\xAF" }, { "YIcy", "\xD0\x87" },
+        { "YUcy", "\xD0\xAE" }, { "Yacute", "\xC3\x9D" }, { "Ycirc", "\xC5\xB6" }, { "Ycy", "\xD0\xAB" },
+        { "Yfr", "\xF0\x9D\x94\x9C" }, { "Yopf", "\xF0\x9D\x95\x90" }, { "Yscr", "\xF0\x9D\x92\xB4" },
+        { "Yuml", "\xC5\xB8" }, { "ZHcy", "\xD0\x96" }, { "Zacute", "\xC5\xB9" }, { "Zcaron", "\xC5\xBD" },
+        { "Zcy", "\xD0\x97" }, { "Zdot", "\xC5\xBB" }, { "ZeroWidthSpace", "\xE2\x80\x8B" }, { "Zeta", "\xCE\x96" },
+        { "Zfr", "\xE2\x84\xA8" }, { "Zopf", "\xE2\x84\xA4" }, { "Zscr", "\xF0\x9D\x92\xB5" }, { "aacute", "\xC3\xA1" },
+        { "abreve", "\xC4\x83" }, { "ac", "\xE2\x88\xBE" }, { "acE", "\xE2\x88\xBE\xCC\xB3" },
+        { "acd", "\xE2\x88\xBF" }, { "acirc", "\xC3\xA2" }, { "acute", "\xC2\xB4" }, { "acy", "\xD0\xB0" },
+        { "aelig", "\xC3\xA6" }, { "af", "\xE2\x81\xA1" }, { "afr", "\xF0\x9D\x94\x9E" }, { "agrave", "\xC3\xA0" },
+        { "alefsym", "\xE2\x84\xB5" }, { "aleph", "\xE2\x84\xB5" }, { "alpha", "\xCE\xB1" }, { "amacr", "\xC4\x81" },
+        { "amalg", "\xE2\xA8\xBF" }, { "amp", "\x26" }, { "and", "\xE2\x88\xA7" }, { "andand", "\xE2\xA9\x95" },
+        { "andd", "\xE2\xA9\x9C" }, { "andslope", "\xE2\xA9\x98" }, { "andv", "\xE2\xA9\x9A" },
+        { "ang", "\xE2\x88\xA0" }, { "ange", "\xE2\xA6\xA4" }, { "angle", "\xE2\x88\xA0" },
+        { "angmsd", "\xE2\x88\xA1" }, { "angmsdaa", "\xE2\xA6\xA8" }, { "angmsdab", "\xE2\xA6\xA9" },
+        { "angmsdac", "\xE2\xA6\xAA" }, { "angmsdad", "\xE2\xA6\xAB" }, { "angmsdae", "\xE2\xA6\xAC" },
+        { "angmsdaf", "\xE2\xA6\xAD" }, { "angmsdag", "\xE2\xA6\xAE" }, { "angmsdah", "\xE2\xA6\xAF" },
+        { "angrt", "\xE2\x88\x9F" }, { "angrtvb", "\xE2\x8A\xBE" }, { "angrtvbd", "\xE2\xA6\x9D" },
+        { "angsph", "\xE2\x88\xA2" }, { "angst", "\xC3\x85" }, { "angzarr", "\xE2\x8D\xBC" }, { "aogon", "\xC4\x85" },
+        { "aopf", "\xF0\x9D\x95\x92" }, { "ap", "\xE2\x89\x88" }, { "apE", "\xE2\xA9\xB0" },
+        { "apacir", "\xE2\xA9\xAF" }, { "ape", "\xE2\x89\x8A" }, { "apid", "\xE2\x89\x8B" }, { "apos", "\x27" },
+        { "approx", "\xE2\x89\x88" }, { "approxeq", "\xE2\x89\x8A" }, { "aring", "\xC3\xA5" },
+        { "ascr", "\xF0\x9D\x92\xB6" }, { "ast", "\x2A" }, { "asymp", "\xE2\x89\x88" }, { "asympeq", "\xE2\x89\x8D" },
+        { "atilde", "\xC3\xA3" }, { "auml", "\xC3\xA4" }, { "awconint", "\xE2\x88\xB3" }, { "awint", "\xE2\xA8\x91" },
+        { "bNot", "\xE2\xAB\xAD" }, { "backcong", "\xE2\x89\x8C" }, { "backepsilon", "\xCF\xB6" },
+        { "backprime", "\xE2\x80\xB5" }, { "backsim", "\xE2\x88\xBD" }, { "backsimeq", "\xE2\x8B\x8D" },
+        { "barvee", "\xE2\x8A\xBD" }, { "barwed", "\xE2\x8C\x85" }, { "barwedge", "\xE2\x8C\x85" },
+        { "bbrk", "\xE2\x8E\xB5" }, { "bbrktbrk", "\xE2\x8E\xB6" }, { "bcong", "\xE2\x89\x8C" }, { "bcy", "\xD0\xB1" },
+        { "bdquo", "\xE2\x80\x9E" }, { "becaus", "\xE2\x88\xB5" }, { "because", "\xE2\x88\xB5" },
+        { "bemptyv", "\xE2\xA6\xB0" }, { "bepsi", "\xCF\xB6" }, { "bernou", "\xE2\x84\xAC" }, { "beta", "\xCE\xB2" },
+        { "beth", "\xE2\x84\xB6" }, { "between", "\xE2\x89\xAC" }, { "bfr", "\xF0\x9D\x94\x9F" },
+        { "bigcap", "\xE2\x8B\x82" }, { "bigcirc", "\xE2\x97\xAF" }, { "bigcup", "\xE2\x8B\x83" },
+        { "bigodot", "\xE2\xA8\x80" }, { "bigoplus", "\xE2\xA8\x81" }, { "bigotimes", "\xE2\xA8\x82" },
+        { "bigsqcup", "\xE2\xA8\x86" }, { "bigstar", "\xE2\x98\x85" }, { "bigtriangledown", "\xE2\x96\xBD" },
+        { "bigtriangleup", "\xE2\x96\xB3" }, { "biguplus", "\xE2\xA8\x84" }, { "bigvee", "\xE2\x8B\x81" },
+        { "bigwedge", "\xE2\x8B\x80" }, { "bkarow", "\xE2\xA4\x8D" }, { "blacklozenge", "\xE2\xA7\xAB" },
+        { "blacksquare", "\xE2\x96\xAA" }, { "blacktriangle", "\xE2\x96\xB4" }, { "blacktriangledown", "\xE2\x96\xBE" },
+        { "blacktriangleleft", "\xE2\x97\x82" }, { "blacktriangleright", "\xE2\x96\xB8" }, { "blank", "\xE2\x90\xA3" },
+        { "blk12", "\xE2\x96\x92" }, { "blk14", "\xE2\x96\x91" }, { "blk34", "\xE2\x96\x93" },
+        { "block", "\xE2\x96\x88" }, { "bne", "\x3D\xE2\x83\xA5" }, { "bnequiv", "\xE2\x89\xA1\xE2\x83\xA5" },
+        { "bnot", "\xE2\x8C\x90" }, { "bopf", "\xF0\x9D\x95\x93" }, { "bot", "\xE2\x8A\xA5" },
+        { "bottom", "\xE2\x8A\xA5" }, { "bowtie", "\xE2\x8B\x88" }, { "boxDL", "\xE2\x95\x97" },
+        { "boxDR", "\xE2\x95\x94" }, { "boxDl", "\xE2\x95\x96" }, { "boxDr", "\xE2\x95\x93" },
+        { "boxH", "\xE2\x95\x90" }, { "boxHD", "\xE2\x95\xA6" }, { "boxHU", "\xE2\x95\xA9" },
+        { "boxHd", "\xE2\x95\xA4" }, { "boxHu", "\xE2\x95\xA7" }, { "boxUL", "\xE2\x95\x9D" },
+        { "boxUR", "\xE2\x95\x9A" }, { "boxUl", "\xE2\x95\x9C" }, { "boxUr", "\xE2\x95\x99" },
+        { "boxV", "\xE2\x95\x91" }, { "boxVH", "\xE2\x95\xAC" }, { "boxVL", "\xE2\x95\xA3" },
+        { "boxVR", "\xE2\x95\xA0" }, { "boxVh", "\xE2\x95\xAB" }, { "boxVl", "\xE2\x95\xA2" },
+        { "boxVr", "\xE2\x95\x9F" }, { "boxbox", "\xE2\xA7\x89" }, { "boxdL", "\xE2\x95\x95" },
+        { "boxdR", "\xE2\x95\x92" }, { "boxdl", "\xE2\x94\x90" }, { "boxdr", "\xE2\x94\x8C" },
+        { "boxh", "\xE2\x94\x80" }, { "boxhD", "\xE2\x95\xA5" }, { "boxhU", "\xE2\x95\xA8" },
+        { "boxhd", "\xE2\x94\xAC" }, { "boxhu", "\xE2\x94\xB4" }, { "boxminus", "\xE2\x8A\x9F" },
+        { "boxplus", "\xE2\x8A\x9E" }, { "boxtimes", "\xE2\x8A\xA0" }, { "boxuL", "\xE2\x95\x9B" },
+        { "boxuR", "\xE2\x95\x98" }, { "boxul", "\xE2\x94\x98" }, { "boxur", "\xE2\x94\x94" },
+        { "boxv", "\xE2\x94\x82" }, { "boxvH", "\xE2\x95\xAA" }, { "boxvL", "\xE2\x95\xA1" },
+        { "boxvR", "\xE2\x95\x9E" }, { "boxvh", "\xE2\x94\xBC" }, { "boxvl", "\xE2\x94\xA4" },
+        { "boxvr", "\xE2\x94\x9C" }, { "bprime", "\xE2\x80\xB5" }, { "breve", "\xCB\x98" }, { "brvbar", "\xC2\xA6" },
+        { "bscr", "\xF0\x9D\x92\xB7" }, { "bsemi", "\xE2\x81\x8F" }, { "bsim", "\xE2\x88\xBD" },
+        { "bsime", "\xE2\x8B\x8D" }, { "bsol", "\x5C" }, { "bsolb", "\xE2\xA7\x85" }, { "bsolhsub", "\xE2\x9F\x88" },
+        { "bull", "\xE2\x80\xA2" }, { "bullet", "\xE2\x80\xA2" }, { "bump", "\xE2\x89\x8E" },
+        { "bumpE", "\xE2\xAA\xAE" }, { "bumpe", "\xE2\x89\x8F" }, { "bumpeq", "\xE2\x89\x8F" },
+        { "cacute", "\xC4\x87" }, { "cap", "\xE2\x88\xA9" }, { "capand", "\xE2\xA9\x84" },
+        { "capbrcup", "\xE2\xA9\x89" }, { "capcap", "\xE2\xA9\x8B" }, { "capcup", "\xE2\xA9\x87" },
+        { "capdot", "\xE2\xA9\x80" }, { "caps", "\xE2\x88\xA9\xEF\xB8\x80" }, { "caret", "\xE2\x81\x81" },
+        { "caron", "\xCB\x87" }, { "ccaps", "\xE2\xA9\x8D" }, { "ccaron", "\xC4\x8D" }, { "ccedil", "\xC3\xA7" },
+        { "ccirc", "\xC4\x89" }, { "ccups", "\xE2\xA9\x8C" }, { "ccupssm", "\xE2\xA9\x90" }, { "cdot", "\xC4\x8B" },
+        { "cedil", "\xC2\xB8" }, { "cemptyv", "\xE2\xA6\xB2" }, { "cent", "\xC2\xA2" }, { "centerdot", "\xC2\xB7" },
+        { "cfr", "\xF0\x9D\x94\xA0" }, { "chcy", "\xD1\x87" }, { "check", "\xE2\x9C\x93" },
+        { "checkmark", "\xE2\x9C\x93" }, { "chi", "\xCF\x87" }, { "cir", "\xE2\x97\x8B" }, { "cirE", "\xE2\xA7\x83" },
+        { "circ", "\xCB\x86" }, { "circeq", "\xE2\x89\x97" }, { "circlearrowleft", "\xE2\x86\xBA" },
+        { "circlearrowright", "\xE2\x86\xBB" }, { "circledR", "\xC2\xAE" }, { "circledS", "\xE2\x93\x88" },
+        { "circledast", "\xE2\x8A\x9B" }, { "circledcirc", "\xE2\x8A\x9A" }, { "circleddash", "\xE2\x8A\x9D" },
+        { "cire", "\xE2\x89\x97" }, { "cirfnint", "\xE2\xA8\x90" }, { "cirmid", "\xE2\xAB\xAF" },
+        { "cirscir", "\xE2\xA7\x82" }, { "clubs", "\xE2\x99\xA3" }, { "clubsuit", "\xE2\x99\xA3" }, { "colon", "\x3A" },
+        { "colone", "\xE2\x89\x94" }, { "coloneq", "\xE2\x89\x94" }, { "comma", "\x2C" }, { "commat", "\x40" },
+        { "comp", "\xE2\x88\x81" }, { "compfn", "\xE2\x88\x98" }, { "complement", "\xE2\x88\x81" },
+        { "complexes", "\xE2\x84\x82" }, { "cong", "\xE2\x89\x85" }, { "congdot", "\xE2\xA9\xAD" },
+        { "conint", "\xE2\x88\xAE" }, { "copf", "\xF0\x9D\x95\x94" }, { "coprod", "\xE2\x88\x90" },
+        { "copy", "\xC2\xA9" }, { "copysr", "\xE2\x84\x97" }, { "crarr", "\xE2\x86\xB5" }, { "cross", "\xE2\x9C\x97" },
+        { "cscr", "\xF0\x9D\x92\xB8" }, { "csub", "\xE2\xAB\x8F" }, { "csube", "\xE2\xAB\x91" },
+        { "csup", "\xE2\xAB\x90" }, { "csupe", "\xE2\xAB\x92" }, { "ctdot", "\xE2\x8B\xAF" },
+        { "cudarrl", "\xE2\xA4\xB8" }, { "cudarrr", "\xE2\xA4\xB5" }, { "cuepr", "\xE2\x8B\x9E" },
+        { "cuesc", "\xE2\x8B\x9F" }, { "cularr", "\xE2\x86\xB6" }, { "cularrp", "\xE2\xA4\xBD" },
+        { "cup", "\xE2\x88\xAA" }, { "cupbrcap", "\xE2\xA9\x88" }, { "cupcap", "\xE2\xA9\x86" },
+        { "cupcup", "\xE2\xA9\x8A" }, { "cupdot", "\xE2\x8A\x8D" }, { "cupor", "\xE2\xA9\x85" },
+        { "cups", "\xE2\x88\xAA\xEF\xB8\x80" }, { "curarr", "\xE2\x86\xB7" }, { "curarrm", "\xE2\xA4\xBC" },
+        { "curlyeqprec", "\xE2\x8B\x9E" }, { "curlyeqsucc", "\xE2\x8B\x9F" }, { "curlyvee", "\xE2\x8B\x8E" },
+        { "curlywedge", "\xE2\x8B\x8F" }, { "curren", "\xC2\xA4" }, { "curvearrowleft", "\xE2\x86\xB6" },
+        { "curvearrowright", "\xE2\x86\xB7" }, { "cuvee", "\xE2\x8B\x8E" }, { "cuwed", "\xE2\x8B\x8F" },
+        { "cwconint", "\xE2\x88\xB2" }, { "cwint", "\xE2\x88\xB1" }, { "cylcty", "\xE2\x8C\xAD" },
+        { "dArr", "\xE2\x87\x93" }, { "dHar", "\xE2\xA5\xA5" }, { "dagger", "\xE2\x80\xA0" },
+        { "daleth", "\xE2\x84\xB8" }, { "darr", "\xE2\x86\x93" }, { "dash", "\xE2\x80\x90" },
+        { "dashv", "\xE2\x8A\xA3" }, { "dbkarow", "\xE2\xA4\x8F" }, { "dblac", "\xCB\x9D" }, { "dcaron", "\xC4\x8F" },
+        { "dcy", "\xD0\xB4" }, { "dd", "\xE2\x85\x86" }, { "ddagger", "\xE2\x80\xA1" }, { "ddarr", "\xE2\x87\x8A" },
+        { "ddotseq", "\xE2\xA9\xB7" }, { "deg", "\xC2\xB0" }, { "delta", "\xCE\xB4" }, { "demptyv", "\xE2\xA6\xB1" },
+        { "dfisht", "\xE2\xA5\xBF" }, { "dfr", "\xF0\x9D\x94\xA1" }, { "dharl", "\xE2\x87\x83" },
+        { "dharr", "\xE2\x87\x82" }, { "diam", "\xE2\x8B\x84" }, { "diamond", "\xE2\x8B\x84" },
+        { "diamondsuit", "\xE2\x99\xA6" }, { "diams", "\xE2\x99\xA6" }, { "die", "\xC2\xA8" },
+        { "digamma", "\xCF\x9D" }, { "disin", "\xE2\x8B\xB2" }, { "div", "\xC3\xB7" }, { "divide", "\xC3\xB7" },
+        { "divideontimes", "\xE2\x8B\x87" }, { "divonx", "\xE2\x8B\x87" }, { "djcy", "\xD1\x92" },
+        { "dlcorn", "\xE2\x8C\x9E" }, { "dlcrop", "\xE2\x8C\x8D" }, { "dollar", "\x24" },
+        { "dopf", "\xF0\x9D\x95\x95" }, { "dot", "\xCB\x99" }, { "doteq", "\xE2\x89\x90" },
+        { "doteqdot", "\xE2\x89\x91" }, { "dotminus", "\xE2\x88\xB8" }, { "dotplus", "\xE2\x88\x94" },
+        { "dotsquare", "\xE2\x8A\xA1" }, { "doublebarwedge", "\xE2\x8C\x86" }, { "downarrow", "\xE2\x86\x93" },
+        { "downdownarrows", "\xE2\x87\x8A" }, { "downharpoonleft", "\xE2\x87\x83" },
+        { "downharpoonright", "\xE2\x87\x82" }, { "drbkarow", "\xE2\xA4\x90" }, { "drcorn", "\xE2\x8C\x9F" },
+        { "drcrop", "\xE2\x8C\x8C" }, { "dscr", "\xF0\x9D\x92\xB9" }, { "dscy", "\xD1\x95" },
+        { "dsol", "\xE2\xA7\xB6" }, { "dstrok", "\xC4\x91" }, { "dtdot", "\xE2\x8B\xB1" }, { "dtri", "\xE2\x96\xBF" },
+        { "dtrif", "\xE2\x96\xBE" }, { "duarr", "\xE2\x87\xB5" }, { "duhar", "\xE2\xA5\xAF" },
+        { "dwangle", "\xE2\xA6\xA6" }, { "dzcy", "\xD1\x9F" }, { "dzigrarr", "\xE2\x9F\xBF" },
+        { "eDDot", "\xE2\xA9\xB7" }, { "eDot", "\xE2\x89\x91" }, { "eacute", "\xC3\xA9" }, { "easter", "\xE2\xA9\xAE" },
+        { "ecaron", "\xC4\x9B" }, { "ecir", "\xE2\x89\x96" }, { "ecirc", "\xC3\xAA" }, { "ecolon", "\xE2\x89\x95" },
+        { "ecy", "\xD1\x8D" }, { "edot", "\xC4\x97" }, { "ee", "\xE2\x85\x87" }, { "efDot", "\xE2\x89\x92" },
+        { "efr", "\xF0\x9D\x94\xA2" }, { "eg", "\xE2\xAA\x9A" }, { "egrave", "\xC3\xA8" }, { "egs", "\xE2\xAA\x96" },
+        { "egsdot", "\xE2\xAA\x98" }, { "el", "\xE2\xAA\x99" }, { "elinters", "\xE2\x8F\xA7" },
+        { "ell", "\xE2\x84\x93" }, { "els", "\xE2\xAA\x95" }, { "elsdot", "\xE2\xAA\x97" }, { "emacr", "\xC4\x93" },
+        { "empty", "\xE2\x88\x85" }, { "emptyset", "\xE2\x88\x85" }, { "emptyv", "\xE2\x88\x85" },
+        { "emsp", "\xE2\x80\x83" }, { "emsp13", "\xE2\x80\x84" }, { "emsp14", "\xE2\x80\x85" }, { "eng", "\xC5\x8B" },
+        { "ensp", "\xE2\x80\x82" }, { "eogon", "\xC4\x99" }, { "eopf", "\xF0\x9D\x95\x96" }, { "epar", "\xE2\x8B\x95" },
+        { "eparsl", "\xE2\xA7\xA3" }, { "eplus", "\xE2\xA9\xB1" }, { "epsi", "\xCE\xB5" }, { "epsilon", "\xCE\xB5" },
+        { "epsiv", "\xCF\xB5" }, { "eqcirc", "\xE2\x89\x96" }, { "eqcolon", "\xE2\x89\x95" },
+        { "eqsim", "\xE2\x89\x82" }, { "eqslantgtr", "\xE2\xAA\x96" }, { "eqslantless", "\xE2\xAA\x95" },
+        { "equals", "\x3D" }, { "equest", "\xE2\x89\x9F" }, { "equiv", "\xE2\x89\xA1" }, { "equivDD", "\xE2\xA9\xB8" },
+        { "eqvparsl", "\xE2\xA7\xA5" }, { "erDot", "\xE2\x89\x93" }, { "erarr", "\xE2\xA5\xB1" },
+        { "escr", "\xE2\x84\xAF" }, { "esdot", "\xE2\x89\x90" }, { "esim", "\xE2\x89\x82" }, { "eta", "\xCE\xB7" },
+        { "eth", "\xC3\xB0" }, { "euml", "\xC3\xAB" }, { "euro", "\xE2\x82\xAC" }, { "excl", "\x21" },
+        { "exist", "\xE2\x88\x83" }, { "expectation", "\xE2\x84\xB0" }, { "exponentiale", "\xE2\x85\x87" },
+        { "fallingdotseq", "\xE2\x89\x92" }, { "fcy", "\xD1\x84" }, { "female", "\xE2\x99\x80" },
+        { "ffilig", "\xEF\xAC\x83" }, { "fflig", "\xEF\xAC\x80" }, { "ffllig", "\xEF\xAC\x84" },
+        { "ffr", "\xF0\x9D\x94\xA3" }, { "filig", "\xEF\xAC\x81" }, { "fjlig", "\x66\x6A" }, { "flat", "\xE2\x99\xAD" },
+        { "fllig", "\xEF\xAC\x82" }, { "fltns", "\xE2\x96\xB1" }, { "fnof", "\xC6\x92" },
+        { "fopf", "\xF0\x9D\x95\x97" }, { "forall", "\xE2\x88\x80" }, { "fork", "\xE2\x8B\x94" },
+        { "forkv", "\xE2\xAB\x99" }, { "fpartint", "\xE2\xA8\x8D" }, { "frac12", "\xC2\xBD" },
+        { "frac13", "\xE2\x85\x93" }, { "frac14", "\xC2\xBC" }, { "frac15", "\xE2\x85\x95" },
+        { "frac16", "\xE2\x85\x99" }, { "frac18", "\xE2\x85\x9B" }, { "frac23", "\xE2\x85\x94" },
+        { "frac25", "\xE2\x85\x96" }, { "frac34", "\xC2\xBE" }, { "frac35", "\xE2\x85\x97" },
+        { "frac38", "\xE2\x85\x9C" }, { "frac45", "\xE2\x85\x98" }, { "frac56", "\xE2\x85\x9A" },
+        { "frac58", "\xE2\x85\x9D" }, { "frac78", "\xE2\x85\x9E" }, { "frasl", "\xE2\x81\x84" },
+        { "frown", "\xE2\x8C\xA2" }, { "fscr", "\xF0\x9D\x92\xBB" }, { "gE", "\xE2\x89\xA7" },
+        { "gEl", "\xE2\xAA\x8C" }, { "gacute", "\xC7\xB5" }, { "gamma", "\xCE\xB3" }, { "gammad", "\xCF\x9D" },
+        { "gap", "\xE2\xAA\x86" }, { "gbreve", "\xC4\x9F" }, { "gcirc", "\xC4\x9D" }, { "gcy", "\xD0\xB3" },
+        { "gdot", "\xC4\xA1" }, { "ge", "\xE2\x89\xA5" }, { "gel", "\xE2\x8B\x9B" }, { "geq", "\xE2\x89\xA5" },
+        { "geqq", "\xE2\x89\xA7" }, { "geqslant", "\xE2\xA9\xBE" }, { "ges", "\xE2\xA9\xBE" },
+        { "gescc", "\xE2\xAA\xA9" }, { "gesdot", "\xE2\xAA\x80" }, { "gesdoto", "\xE2\xAA\x82" },
+        { "gesdotol", "\xE2\xAA\x84" }, { "gesl", "\xE2\x8B\x9B\xEF\xB8\x80" }, { "gesles", "\xE2\xAA\x94" },
+        { "gfr", "\xF0\x9D\x94\xA4" }, { "gg", "\xE2\x89\xAB" }, { "ggg", "\xE2\x8B\x99" }, { "gimel", "\xE2\x84\xB7" },
+        { "gjcy", "\xD1\x93" }, { "gl", "\xE2\x89\xB7" }, { "glE", "\xE2\xAA\x92" }, { "gla", "\xE2\xAA\xA5" },
+        { "glj", "\xE2\xAA\xA4" }, { "gnE", "\xE2\x89\xA9" }, { "gnap", "\xE2\xAA\x8A" },
+        { "gnapprox", "\xE2\xAA\x8A" }, { "gne", "\xE2\xAA\x88" }, { "gneq", "\xE2\xAA\x88" },
+        { "gneqq", "\xE2\x89\xA9" }, { "gnsim", "\xE2\x8B\xA7" }, { "gopf", "\xF0\x9D\x95\x98" }, { "grave", "\x60" },
+        { "gscr", "\xE2\x84\x8A" }, { "gsim", "\xE2\x89\xB3" }, { "gsime", "\xE2\xAA\x8E" },
+        { "gsiml", "\xE2\xAA\x90" }, { "gt", "\x3E" }, { "gtcc", "\xE2\xAA\xA7" }, { "gtcir", "\xE2\xA9\xBA" },
+        { "gtdot", "\xE2\x8B\x97" }, { "gtlPar", "\xE2\xA6\x95" }, { "gtquest", "\xE2\xA9\xBC" },
+        { "gtrapprox", "\xE2\xAA\x86" }, { "gtrarr", "\xE2\xA5\xB8" }, { "gtrdot", "\xE2\x8B\x97" },
+        { "gtreqless", "\xE2\x8B\x9B" }, { "gtreqqless", "\xE2\xAA\x8C" }, { "gtrless", "\xE2\x89\xB7" },
+        { "gtrsim", "\xE2\x89\xB3" }, { "gvertneqq", "\xE2\x89\xA9\xEF\xB8\x80" },
+        { "gvnE", "\xE2\x89\xA9\xEF\xB8\x80" }, { "hArr", "\xE2\x87\x94" }, { "hairsp", "\xE2\x80\x8A" },
+        { "half", "\xC2\xBD" }, { "hamilt", "\xE2\x84\x8B" }, { "hardcy", "\xD1\x8A" }, { "harr", "\xE2\x86\x94" },
+        { "harrcir", "\xE2\xA5\x88" }, { "harrw", "\xE2\x86\xAD" }, { "hbar", "\xE2\x84\x8F" }, { "hcirc", "\xC4\xA5" },
+        { "hearts", "\xE2\x99\xA5" }, { "heartsuit", "\xE2\x99\xA5" }, { "hellip", "\xE2\x80\xA6" },
+        { "hercon", "\xE2\x8A\xB9" }, { "hfr", "\xF0\x9D\x94\xA5" }, { "hksearow", "\xE2\xA4\xA5" },
+        { "hkswarow", "\xE2\xA4\xA6" }, { "hoarr", "\xE2\x87\xBF" }, { "homtht", "\xE2\x88\xBB" },
+        { "hookleftarrow", "\xE2\x86\xA9" }, { "hookrightarrow", "\xE2\x86\xAA" }, { "hopf", "\xF0\x9D\x95\x99" },
+        { "horbar", "\xE2\x80\x95" }, { "hscr", "\xF0\x9D\x92\xBD" }, { "hslash", "\xE2\x84\x8F" },
+        { "hstrok", "\xC4\xA7" }, { "hybull", "\xE2\x81\x83" }, { "hyphen", "\xE2\x80\x90" }, { "iacute", "\xC3\xAD" },
+        { "ic", "\xE2\x81\xA3" }, { "icirc", "\xC3\xAE" }, { "icy", "\xD0\xB8" }, { "iecy", "\xD0\xB5" },
+        { "iexcl", "\xC2\xA1" }, { "iff", "\xE2\x87\x94" }, { "ifr", "\xF0\x9D\x94\xA6" }, { "igrave", "\xC3\xAC" },
+        { "ii", "\xE2\x85\x88" }, { "iiiint", "\xE2\xA8\x8C" }, { "iiint", "\xE2\x88\xAD" },
+        { "iinfin", "\xE2\xA7\x9C" }, { "iiota", "\xE2\x84\xA9" }, { "ijlig", "\xC4\xB3" }, { "imacr", "\xC4\xAB" },
+        { "image", "\xE2\x84\x91" }, { "imagline", "\xE2\x84\x90" }, { "imagpart", "\xE2\x84\x91" },
+        { "imath", "\xC4\xB1" }, { "imof", "\xE2\x8A\xB7" }, { "imped", "\xC6\xB5" }, { "in", "\xE2\x88\x88" },
+        { "incare", "\xE2\x84\x85" }, { "infin", "\xE2\x88\x9E" }, { "infintie", "\xE2\xA7\x9D" },
+        { "inodot", "\xC4\xB1" }, { "int", "\xE2\x88\xAB" }, { "intcal", "\xE2\x8A\xBA" },
+        { "integers", "\xE2\x84\xA4" }, { "intercal", "\xE2\x8A\xBA" }, { "intlarhk", "\xE2\xA8\x97" },
+        { "intprod", "\xE2\xA8\xBC" }, { "iocy", "\xD1\x91" }, { "iogon", "\xC4\xAF" }, { "iopf", "\xF0\x9D\x95\x9A" },
+        { "iota", "\xCE\xB9" }, { "iprod", "\xE2\xA8\xBC" }, { "iquest", "\xC2\xBF" }, { "iscr", "\xF0\x9D\x92\xBE" },
+        { "isin", "\xE2\x88\x88" }, { "isinE", "\xE2\x8B\xB9" }, { "isindot", "\xE2\x8B\xB5" },
+        { "isins", "\xE2\x8B\xB4" }, { "isinsv", "\xE2\x8B\xB3" }, { "isinv", "\xE2\x88\x88" },
+        { "it", "\xE2\x81\xA2" }, { "itilde", "\xC4\xA9" }, { "iukcy", "\xD1\x96" }, { "iuml", "\xC3\xAF" },
+        { "jcirc", "\xC4\xB5" }, { "jcy", "\xD0\xB9" }, { "jfr", "\xF0\x9D\x94\xA7" }, { "jmath", "\xC8\xB7" },
+        { "jopf", "\xF0\x9D\x95\x9B" }, { "jscr", "\xF0\x9D\x92\xBF" }, { "jsercy", "\xD1\x98" },
+        { "jukcy", "\xD1\x94" }, { "kappa", "\xCE\xBA" }, { "kappav", "\xCF\xB0" }, { "kcedil", "\xC4\xB7" },
+        { "kcy", "\xD0\xBA" }, { "kfr", "\xF0\x9D\x94\xA8" }, { "kgreen", "\xC4\xB8" }, { "khcy", "\xD1\x85" },
+        { "kjcy", "\xD1\x9C" }, { "kopf", "\xF0\x9D\x95\x9C" }, { "kscr", "\xF0\x9D\x93\x80" },
+        { "lAarr", "\xE2\x87\x9A" }, { "lArr", "\xE2\x87\x90" }, { "lAtail", "\xE2\xA4\x9B" },
+        { "lBarr", "\xE2\xA4\x8E" }, { "lE", "\xE2\x89\xA6" }, { "lEg", "\xE2\xAA\x8B" }, { "lHar", "\xE2\xA5\xA2" },
+        { "lacute", "\xC4\xBA" }, { "laemptyv", "\xE2\xA6\xB4" }, { "lagran", "\xE2\x84\x92" },
+        { "lambda", "\xCE\xBB" }, { "lang", "\xE2\x9F\xA8" }, { "langd", "\xE2\xA6\x91" }, { "langle", "\xE2\x9F\xA8" },
+        { "lap", "\xE2\xAA\x85" }, { "laquo", "\xC2\xAB" }, { "larr", "\xE2\x86\x90" }, { "larrb", "\xE2\x87\xA4" },
+        { "larrbfs", "\xE2\xA4\x9F" }, { "larrfs", "\xE2\xA4\x9D" }, { "larrhk", "\xE2\x86\xA9" },
+        { "larrlp", "\xE2\x86\xAB" }, { "larrpl", "\xE2\xA4\xB9" }, { "larrsim", "\xE2\xA5\xB3" },
+        { "larrtl", "\xE2\x86\xA2" }, { "lat", "\xE2\xAA\xAB" }, { "latail", "\xE2\xA4\x99" },
+        { "late", "\xE2\xAA\xAD" }, { "lates", "\xE2\xAA\xAD\xEF\xB8\x80" }, { "lbarr", "\xE2\xA4\x8C" },
+        { "lbbrk", "\xE2\x9D\xB2" }, { "lbrace", "\x7B" }, { "lbrack", "\x5B" }, { "lbrke", "\xE2\xA6\x8B" },
+        { "lbrksld", "\xE2\xA6\x8F" }, { "lbrkslu", "\xE2\xA6\x8D" }, { "lcaron", "\xC4\xBE" },
+        { "lcedil", "\xC4\xBC" }, { "lceil", "\xE2\x8C\x88" }, { "lcub", "\x7B" }, { "lcy", "\xD0\xBB" },
+        { "ldca", "\xE2\xA4\xB6" }, { "ldquo", "\xE2\x80\x9C" }, { "ldquor", "\xE2\x80\x9E" },
+        { "ldrdhar", "\xE2\xA5\xA7" }, { "ldrushar", "\xE2\xA5\x8B" }, { "ldsh", "\xE2\x86\xB2" },
+        { "le", "\xE2\x89\xA4" }, { "leftarrow", "\xE2\x86\x90" }, { "leftarrowtail", "\xE2\x86\xA2" },
+        { "leftharpoondown", "\xE2\x86\xBD" }, { "leftharpoonup", "\xE2\x86\xBC" },
+        { "leftleftarrows", "\xE2\x87\x87" }, { "leftrightarrow", "\xE2\x86\x94" },
+        { "leftrightarrows", "\xE2\x87\x86" }, { "leftrightharpoons", "\xE2\x87\x8B" },
+        { "leftrightsquigarrow", "\xE2\x86\xAD" }, { "leftthreetimes", "\xE2\x8B\x8B" }, { "leg", "\xE2\x8B\x9A" },
+        { "leq", "\xE2\x89\xA4" }, { "leqq", "\xE2\x89\xA6" }, { "leqslant", "\xE2\xA9\xBD" },
+        { "les", "\xE2\xA9\xBD" }, { "lescc", "\xE2\xAA\xA8" }, { "lesdot", "\xE2\xA9\xBF" },
+        { "lesdoto", "\xE2\xAA\x81" }, { "lesdotor", "\xE2\xAA\x83" }, { "lesg", "\xE2\x8B\x9A\xEF\xB8\x80" },
+        { "lesges", "\xE2\xAA\x93" }, { "lessapprox", "\xE2\xAA\x85" }, { "lessdot", "\xE2\x8B\x96" },
+        { "lesseqgtr", "\xE2\x8B\x9A" }, { "lesseqqgtr", "\xE2\xAA\x8B" }, { "lessgtr", "\xE2\x89\xB6" },
+        { "lesssim", "\xE2\x89\xB2" }, { "lfisht", "\xE2\xA5\xBC" }, { "lfloor", "\xE2\x8C\x8A" },
+        { "lfr", "\xF0\x9D\x94\xA9" }, { "lg", "\xE2\x89\xB6" }, { "lgE", "\xE2\xAA\x91" }, { "lhard", "\xE2\x86\xBD" },
+        { "lharu", "\xE2\x86\xBC" }, { "lharul", "\xE2\xA5\xAA" }, { "lhblk", "\xE2\x96\x84" }, { "ljcy", "\xD1\x99" },
+        { "ll", "\xE2\x89\xAA" }, { "llarr", "\xE2\x87\x87" }, { "llcorner", "\xE2\x8C\x9E" },
+        { "llhard", "\xE2\xA5\xAB" }, { "lltri", "\xE2\x97\xBA" }, { "lmidot", "\xC5\x80" },
+        { "lmoust", "\xE2\x8E\xB0" }, { "lmoustache", "\xE2\x8E\xB0" }, { "lnE", "\xE2\x89\xA8" },
+        { "lnap", "\xE2\xAA\x89" }, { "lnapprox", "\xE2\xAA\x89" }, { "lne", "\xE2\xAA\x87" },
+        { "lneq", "\xE2\xAA\x87" }, { "lneqq", "\xE2\x89\xA8" }, { "lnsim", "\xE2\x8B\xA6" },
+        { "loang", "\xE2\x9F\xAC" }, { "loarr", "\xE2\x87\xBD" }, { "lobrk", "\xE2\x9F\xA6" },
+        { "longleftarrow", "\xE2\x9F\xB5" }, { "longleftrightarrow", "\xE2\x9F\xB7" }, { "longmapsto", "\xE2\x9F\xBC" },
+        { "longrightarrow", "\xE2\x9F\xB6" }, { "looparrowleft", "\xE2\x86\xAB" }, { "looparrowright", "\xE2\x86\xAC" },
+        { "lopar", "\xE2\xA6\x85" }, { "lopf", "\xF0\x9D\x95\x9D" }, { "loplus", "\xE2\xA8\xAD" },
+        { "lotimes", "\xE2\xA8\xB4" }, { "lowast", "\xE2\x88\x97" }, { "lowbar", "\x5F" }, { "loz", "\xE2\x97\x8A" },
+        { "lozenge", "\xE2\x97\x8A" }, { "lozf", "\xE2\xA7\xAB" }, { "lpar", "\x28" }, { "lparlt", "\xE2\xA6\x93" },
+        { "lrarr", "\xE2\x87\x86" }, { "lrcorner", "\xE2\x8C\x9F" }, { "lrhar", "\xE2\x87\x8B" },
+        { "lrhard", "\xE2\xA5\xAD" }, { "lrm", "\xE2\x80\x8E" }, { "lrtri", "\xE2\x8A\xBF" },
+        { "lsaquo", "\xE2\x80\xB9" }, { "lscr", "\xF0\x9D\x93\x81" }, { "lsh", "\xE2\x86\xB0" },
+        { "lsim", "\xE2\x89\xB2" }, { "lsime", "\xE2\xAA\x8D" }, { "lsimg", "\xE2\xAA\x8F" }, { "lsqb", "\x5B" },
+        { "lsquo", "\xE2\x80\x98" }, { "lsquor", "\xE2\x80\x9A" }, { "lstrok", "\xC5\x82" }, { "lt", "\x3C" },
+        { "ltcc", "\xE2\xAA\xA6" }, { "ltcir", "\xE2\xA9\xB9" }, { "ltdot", "\xE2\x8B\x96" },
+        { "lthree", "\xE2\x8B\x8B" }, { "ltimes", "\xE2\x8B\x89" }, { "ltlarr", "\xE2\xA5\xB6" },
+        { "ltquest", "\xE2\xA9\xBB" }, { "ltrPar", "\xE2\xA6\x96" }, { "ltri", "\xE2\x97\x83" },
+        { "ltrie", "\xE2\x8A\xB4" }, { "ltrif", "\xE2\x97\x82" }, { "lurdshar", "\xE2\xA5\x8A" },
+        { "luruhar", "\xE2\xA5\xA6" }, { "lvertneqq", "\xE2\x89\xA8\xEF\xB8\x80" },
+        { "lvnE", "\xE2\x89\xA8\xEF\xB8\x80" }, { "mDDot", "\xE2\x88\xBA" }, { "macr", "\xC2\xAF" },
+        { "male", "\xE2\x99\x82" }, { "malt", "\xE2\x9C\xA0" }, { "maltese", "\xE2\x9C\xA0" },
+        { "map", "\xE2\x86\xA6" }, { "mapsto", "\xE2\x86\xA6" }, { "mapstodown", "\xE2\x86\xA7" },
+        { "mapstoleft", "\xE2\x86\xA4" }, { "mapstoup", "\xE2\x86\xA5" }, { "marker", "\xE2\x96\xAE" },
+        { "mcomma", "\xE2\xA8\xA9" }, { "mcy", "\xD0\xBC" }, { "mdash", "\xE2\x80\x94" },
+        { "measuredangle", "\xE2\x88\xA1" }, { "mfr", "\xF0\x9D\x94\xAA" }, { "mho", "\xE2\x84\xA7" },
+        { "micro", "\xC2\xB5" }, { "mid", "\xE2\x88\xA3" }, { "midast", "\x2A" }, { "midcir", "\xE2\xAB\xB0" },
+        { "middot", "\xC2\xB7" }, { "minus", "\xE2\x88\x92" }, { "minusb", "\xE2\x8A\x9F" },
+        { "minusd", "\xE2\x88\xB8" }, { "minusdu", "\xE2\xA8\xAA" }, { "mlcp", "\xE2\xAB\x9B" },
+        { "mldr", "\xE2\x80\xA6" }, { "mnplus", "\xE2\x88\x93" }, { "models", "\xE2\x8A\xA7" },
+        { "mopf", "\xF0\x9D\x95\x9E" }, { "mp", "\xE2\x88\x93" }, { "mscr", "\xF0\x9D\x93\x82" },
+        { "mstpos", "\xE2\x88\xBE" }, { "mu", "\xCE\xBC" }, { "multimap", "\xE2\x8A\xB8" }, { "mumap", "\xE2\x8A\xB8" },
+        { "nGg", "\xE2\x8B\x99\xCC\xB8" }, { "nGtv", "\xE2\x89\xAB\xCC\xB8" }, { "nLeftarrow", "\xE2\x87\x8D" },
+        { "nLeftrightarrow", "\xE2\x87\x8E" }, { "nLl", "\xE2\x8B\x98\xCC\xB8" }, { "nLtv", "\xE2\x89\xAA\xCC\xB8" },
+        { "nRightarrow", "\xE2\x87\x8F" }, { "nVDash", "\xE2\x8A\xAF" }, { "nVdash", "\xE2\x8A\xAE" },
+        { "nabla", "\xE2\x88\x87" }, { "nacute", "\xC5\x84" }, { "nang", "\xE2\x88\xA0\xE2\x83\x92" },
+        { "nap", "\xE2\x89\x89" }, { "napE", "\xE2\xA9\xB0\xCC\xB8" }, { "napid", "\xE2\x89\x8B\xCC\xB8" },
+        { "napos", "\xC5\x89" }, { "napprox", "\xE2\x89\x89" }, { "natur", "\xE2\x99\xAE" },
+        { "natural", "\xE2\x99\xAE" }, { "naturals", "\xE2\x84\x95" }, { "nbsp", "\xC2\xA0" },
+        { "nbump", "\xE2\x89\x8E\xCC\xB8" }, { "nbumpe", "\xE2\x89\x8F\xCC\xB8" }, { "ncap", "\xE2\xA9\x83" },
+        { "ncaron", "\xC5\x88" }, { "ncedil", "\xC5\x86" }, { "ncong", "\xE2\x89\x87" },
+        { "ncongdot", "\xE2\xA9\xAD\xCC\xB8" }, { "ncup", "\xE2\xA9\x82" }, { "ncy", "\xD0\xBD" },
+        { "ndash", "\xE2\x80\x93" }, { "ne", "\xE2\x89\xA0" }, { "neArr", "\xE2\x87\x97" },
+        { "nearhk", "\xE2\xA4\xA4" }, { "nearr", "\xE2\x86\x97" }, { "nearrow", "\xE2\x86\x97" },
+        { "nedot", "\xE2\x89\x90\xCC\xB8" }, { "nequiv", "\xE2\x89\xA2" }, { "nesear", "\xE2\xA4\xA8" },
+        { "nesim", "\xE2\x89\x82\xCC\xB8" }, { "nexist", "\xE2\x88\x84" }, { "nexists", "\xE2\x88\x84" },
+        { "nfr", "\xF0\x9D\x94\xAB" }, { "ngE", "\xE2\x89\xA7\xCC\xB8" }, { "nge", "\xE2\x89\xB1" },
+        { "ngeq", "\xE2\x89\xB1" }, { "ngeqq", "\xE2\x89\xA7\xCC\xB8" }, { "ngeqslant", "\xE2\xA9\xBE\xCC\xB8" },
+        { "nges", "\xE2\xA9\xBE\xCC\xB8" }, { "ngsim", "\xE2\x89\xB5" }, { "ngt", "\xE2\x89\xAF" },
+        { "ngtr", "\xE2\x89\xAF" }, { "nhArr", "\xE2\x87\x8E" }, { "nharr", "\xE2\x86\xAE" },
+        { "nhpar", "\xE2\xAB\xB2" }, { "ni", "\xE2\x88\x8B" }, { "nis", "\xE2\x8B\xBC" }, { "nisd", "\xE2\x8B\xBA" },
+        { "niv", "\xE2\x88\x8B" }, { "njcy", "\xD1\x9A" }, { "nlArr", "\xE2\x87\x8D" },
+        { "nlE", "\xE2\x89\xA6\xCC\xB8" }, { "nlarr", "\xE2\x86\x9A" }, { "nldr", "\xE2\x80\xA5" },
+        { "nle", "\xE2\x89\xB0" }, { "nleftarrow", "\xE2\x86\x9A" }, { "nleftrightarrow", "\xE2\x86\xAE" },
+        { "nleq", "\xE2\x89\xB0" }, { "nleqq", "\xE2\x89\xA6\xCC\xB8" }, { "nleqslant", "\xE2\xA9\xBD\xCC\xB8" },
+        { "nles", "\xE2\xA9\xBD\xCC\xB8" }, { "nless", "\xE2\x89\xAE" }, { "nlsim", "\xE2\x89\xB4" },
+        { "nlt", "\xE2\x89\xAE" }, { "nltri", "\xE2\x8B\xAA" }, { "nltrie", "\xE2\x8B\xAC" },
+        { "nmid", "\xE2\x88\xA4" }, { "nopf", "\xF0\x9D\x95\x9F" }, { "not", "\xC2\xAC" }, { "notin", "\xE2\x88\x89" },
+        { "notinE", "\xE2\x8B\xB9\xCC\xB8" }, { "notindot", "\xE2\x8B\xB5\xCC\xB8" }, { "notinva", "\xE2\x88\x89" },
+        { "notinvb", "\xE2\x8B\xB7" }, { "notinvc", "\xE2\x8B\xB6" }, { "notni", "\xE2\x88\x8C" },
+        { "notniva", "\xE2\x88\x8C" }, { "notnivb", "\xE2\x8B\xBE" }, { "notnivc", "\xE2\x8B\xBD" },
+        { "npar", "\xE2\x88\xA6" }, { "nparallel", "\xE2\x88\xA6" }, { "nparsl", "\xE2\xAB\xBD\xE2\x83\xA5" },
+        { "npart", "\xE2\x88\x82\xCC\xB8" }, { "npolint", "\xE2\xA8\x94" }, { "npr", "\xE2\x8A\x80" },
+        { "nprcue", "\xE2\x8B\xA0" }, { "npre", "\xE2\xAA\xAF\xCC\xB8" }, { "nprec", "\xE2\x8A\x80" },
+        { "npreceq", "\xE2\xAA\xAF\xCC\xB8" }, { "nrArr", "\xE2\x87\x8F" }, { "nrarr", "\xE2\x86\x9B" },
+        { "nrarrc", "\xE2\xA4\xB3\xCC\xB8" }, { "nrarrw", "\xE2\x86\x9D\xCC\xB8" }, { "nrightarrow", "\xE2\x86\x9B" },
+        { "nrtri", "\xE2\x8B\xAB" }, { "nrtrie", "\xE2\x8B\xAD" }, { "nsc", "\xE2\x8A\x81" },
+        { "nsccue", "\xE2\x8B\xA1" }, { "nsce", "\xE2\xAA\xB0\xCC\xB8" }, { "nscr", "\xF0\x9D\x93\x83" },
+        { "nshortmid", "\xE2\x88\xA4" }, { "nshortparallel", "\xE2\x88\xA6" }, { "nsim", "\xE2\x89\x81" },
+        { "nsime", "\xE2\x89\x84" }, { "nsimeq", "\xE2\x89\x84" }, { "nsmid", "\xE2\x88\xA4" },
+        { "nspar", "\xE2\x88\xA6" }, { "nsqsube", "\xE2\x8B\xA2" }, { "nsqsupe", "\xE2\x8B\xA3" },
+        { "nsub", "\xE2\x8A\x84" }, { "nsubE", "\xE2\xAB\x85\xCC\xB8" }, { "nsube", "\xE2\x8A\x88" },
+        { "nsubset", "\xE2\x8A\x82\xE2\x83\x92" }, { "nsubseteq", "\xE2\x8A\x88" },
+        { "nsubseteqq", "\xE2\xAB\x85\xCC\xB8" }, { "nsucc", "\xE2\x8A\x81" }, { "nsucceq", "\xE2\xAA\xB0\xCC\xB8" },
+        { "nsup", "\xE2\x8A\x85" }, { "nsupE", "\xE2\xAB\x86\xCC\xB8" }, { "nsupe", "\xE2\x8A\x89" },
+        { "nsupset", "\xE2\x8A\x83\xE2\x83\x92" }, { "nsupseteq", "\xE2\x8A\x89" },
+        { "nsupseteqq", "\xE2\xAB\x86\xCC\xB8" }, { "ntgl", "\xE2\x89\xB9" }, { "ntilde", "\xC3\xB1" },
+        { "ntlg", "\xE2\x89\xB8" }, { "ntriangleleft", "\xE2\x8B\xAA" }, { "ntrianglelefteq", "\xE2\x8B\xAC" },
+        { "ntriangleright", "\xE2\x8B\xAB" }, { "ntrianglerighteq", "\xE2\x8B\xAD" }, { "nu", "\xCE\xBD" },
+        { "num", "\x23" }, { "numero", "\xE2\x84\x96" }, { "numsp", "\xE2\x80\x87" }, { "nvDash", "\xE2\x8A\xAD" },
+        { "nvHarr", "\xE2\xA4\x84" }, { "nvap", "\xE2\x89\x8D\xE2\x83\x92" }, { "nvdash", "\xE2\x8A\xAC" },
+        { "nvge", "\xE2\x89\xA5\xE2\x83\x92" }, { "nvgt", "\x3E\xE2\x83\x92" }, { "nvinfin", "\xE2\xA7\x9E" },
+        { "nvlArr", "\xE2\xA4\x82" }, { "nvle", "\xE2\x89\xA4\xE2\x83\x92" }, { "nvlt", "\x3C\xE2\x83\x92" },
+        { "nvltrie", "\xE2\x8A\xB4\xE2\x83\x92" }, { "nvrArr", "\xE2\xA4\x83" },
+        { "nvrtrie", "\xE2\x8A\xB5\xE2\x83\x92" }, { "nvsim", "\xE2\x88\xBC\xE2\x83\x92" }, { "nwArr", "\xE2\x87\x96" },
+        { "nwarhk", "\xE2\xA4\xA3" }, { "nwarr", "\xE2\x86\x96" }, { "nwarrow", "\xE2\x86\x96" },
+        { "nwnear", "\xE2\xA4\xA7" }, { "oS", "\xE2\x93\x88" }, { "oacute", "\xC3\xB3" }, { "oast", "\xE2\x8A\x9B" },
+        { "ocir", "\xE2\x8A\x9A" }, { "ocirc", "\xC3\xB4" }, { "ocy", "\xD0\xBE" }, { "odash", "\xE2\x8A\x9D" },
+        { "odblac", "\xC5\x91" }, { "odiv", "\xE2\xA8\xB8" }, { "odot", "\xE2\x8A\x99" }, { "odsold", "\xE2\xA6\xBC" },
+        { "oelig", "\xC5\x93" }, { "ofcir", "\xE2\xA6\xBF" }, { "ofr", "\xF0\x9D\x94\xAC" }, { "ogon", "\xCB\x9B" },
+        { "ograve", "\xC3\xB2" }, { "ogt", "\xE2\xA7\x81" }, { "ohbar", "\xE2\xA6\xB5" }, { "ohm", "\xCE\xA9" },
+        { "oint", "\xE2\x88\xAE" }, { "olarr", "\xE2\x86\xBA" }, { "olcir", "\xE2\xA6\xBE" },
+        { "olcross", "\xE2\xA6\xBB" }, { "oline", "\xE2\x80\xBE" }, { "olt", "\xE2\xA7\x80" }, { "omacr", "\xC5\x8D" },
+        { "omega", "\xCF\x89" }, { "omicron", "\xCE\xBF" }, { "omid", "\xE2\xA6\xB6" }, { "ominus", "\xE2\x8A\x96" },
+        { "oopf", "\xF0\x9D\x95\xA0" }, { "opar", "\xE2\xA6\xB7" }, { "operp", "\xE2\xA6\xB9" },
+        { "oplus", "\xE2\x8A\x95" }, { "or", "\xE2\x88\xA8" }, { "orarr", "\xE2\x86\xBB" }, { "ord", "\xE2\xA9\x9D" },
+        { "order", "\xE2\x84\xB4" }, { "orderof", "\xE2\x84\xB4" }, { "ordf", "\xC2\xAA" }, { "ordm", "\xC2\xBA" },
+        { "origof", "\xE2\x8A\xB6" }, { "oror", "\xE2\xA9\x96" }, { "orslope", "\xE2\xA9\x97" },
+        { "orv", "\xE2\xA9\x9B" }, { "oscr", "\xE2\x84\xB4" }, { "oslash", "\xC3\xB8" }, { "osol", "\xE2\x8A\x98" },
+        { "otilde", "\xC3\xB5" }, { "otimes", "\xE2\x8A\x97" }, { "otimesas", "\xE2\xA8\xB6" }, { "ouml", "\xC3\xB6" },
+        { "ovbar", "\xE2\x8C\xBD" }, { "par", "\xE2\x88\xA5" }, { "para", "\xC2\xB6" }, { "parallel", "\xE2\x88\xA5" },
+        { "parsim", "\xE2\xAB\xB3" }, { "parsl", "\xE2\xAB\xBD" }, { "part", "\xE2\x88\x82" }, { "pcy", "\xD0\xBF" },
+        { "percnt", "\x25" }, { "period", "\x2E" }, { "permil", "\xE2\x80\xB0" }, { "perp", "\xE2\x8A\xA5" },
+        { "pertenk", "\xE2\x80\xB1" }, { "pfr", "\xF0\x9D\x94\xAD" }, { "phi", "\xCF\x86" }, { "phiv", "\xCF\x95" },
+        { "phmmat", "\xE2\x84\xB3" }, { "phone", "\xE2\x98\x8E" }, { "pi", "\xCF\x80" },
+        { "pitchfork", "\xE2\x8B\x94" }, { "piv", "\xCF\x96" }, { "planck", "\xE2\x84\x8F" },
+        { "planckh", "\xE2\x84\x8E" }, { "plankv", "\xE2\x84\x8F" }, { "plus", "\x2B" }, { "plusacir", "\xE2\xA8\xA3" },
+        { "plusb", "\xE2\x8A\x9E" }, { "pluscir", "\xE2\xA8\xA2" }, { "plusdo", "\xE2\x88\x94" },
+        { "plusdu", "\xE2\xA8\xA5" }, { "pluse", "\xE2\xA9\xB2" }, { "plusmn", "\xC2\xB1" },
+        { "plussim", "\xE2\xA8\xA6" }, { "plustwo", "\xE2\xA8\xA7" }, { "pm", "\xC2\xB1" },
+        { "pointint", "\xE2\xA8\x95" }, { "popf", "\xF0\x9D\x95\xA1" }, { "pound", "\xC2\xA3" },
+        { "pr", "\xE2\x89\xBA" }, { "prE", "\xE2\xAA\xB3" }, { "prap", "\xE2\xAA\xB7" }, { "prcue", "\xE2\x89\xBC" },
+        { "pre", "\xE2\xAA\xAF" }, { "prec", "\xE2\x89\xBA" }, { "precapprox", "\xE2\xAA\xB7" },
+        { "preccurlyeq", "\xE2\x89\xBC" }, { "preceq", "\xE2\xAA\xAF" }, { "precnapprox", "\xE2\xAA\xB9" },
+        { "precneqq", "\xE2\xAA\xB5" }, { "precnsim", "\xE2\x8B\xA8" }, { "precsim", "\xE2\x89\xBE" },
+        { "prime", "\xE2\x80\xB2" }, { "primes", "\xE2\x84\x99" }, { "prnE", "\xE2\xAA\xB5" },
+        { "prnap", "\xE2\xAA\xB9" }, { "prnsim", "\xE2\x8B\xA8" }, { "prod", "\xE2\x88\x8F" },
+        { "profalar", "\xE2\x8C\xAE" }, { "profline", "\xE2\x8C\x92" }, { "profsurf", "\xE2\x8C\x93" },
+        { "prop", "\xE2\x88\x9D" }, { "propto", "\xE2\x88\x9D" }, { "prsim", "\xE2\x89\xBE" },
+        { "prurel", "\xE2\x8A\xB0" }, { "pscr", "\xF0\x9D\x93\x85" }, { "psi", "\xCF\x88" },
+        { "puncsp", "\xE2\x80\x88" }, { "qfr", "\xF0\x9D\x94\xAE" }, { "qint", "\xE2\xA8\x8C" },
+        { "qopf", "\xF0\x9D\x95\xA2" }, { "qprime", "\xE2\x81\x97" }, { "qscr", "\xF0\x9D\x93\x86" },
+        { "quaternions", "\xE2\x84\x8D" }, { "quatint", "\xE2\xA8\x96" }, { "quest", "\x3F" },
+        { "questeq", "\xE2\x89\x9F" }, { "quot", "\x22" }, { "rAarr", "\xE2\x87\x9B" }, { "rArr", "\xE2\x87\x92" },
+        { "rAtail", "\xE2\xA4\x9C" }, { "rBarr", "\xE2\xA4\x8F" }, { "rHar", "\xE2\xA5\xA4" },
+        { "race", "\xE2\x88\xBD\xCC\xB1" }, { "racute", "\xC5\x95" }, { "radic", "\xE2\x88\x9A" },
+        { "raemptyv", "\xE2\xA6\xB3" }, { "rang", "\xE2\x9F\xA9" }, { "rangd", "\xE2\xA6\x92" },
+        { "range", "\xE2\xA6\xA5" }, { "rangle", "\xE2\x9F\xA9" }, { "raquo", "\xC2\xBB" }, { "rarr", "\xE2\x86\x92" },
+        { "rarrap", "\xE2\xA5\xB5" }, { "rarrb", "\xE2\x87\xA5" }, { "rarrbfs", "\xE2\xA4\xA0" },
+        { "rarrc", "\xE2\xA4\xB3" }, { "rarrfs", "\xE2\xA4\x9E" }, { "rarrhk", "\xE2\x86\xAA" },
+        { "rarrlp", "\xE2\x86\xAC" }, { "rarrpl", "\xE2\xA5\x85" }, { "rarrsim", "\xE2\xA5\xB4" },
+        { "rarrtl", "\xE2\x86\xA3" }, { "rarrw", "\xE2\x86\x9D" }, { "ratail", "\xE2\xA4\x9A" },
+        { "ratio", "\xE2\x88\xB6" }, { "rationals", "\xE2\x84\x9A" }, { "rbarr", "\xE2\xA4\x8D" },
+        { "rbbrk", "\xE2\x9D\xB3" }, { "rbrace", "\x7D" }, { "rbrack", "\x5D" }, { "rbrke", "\xE2\xA6\x8C" },
+        { "rbrksld", "\xE2\xA6\x8E" }, { "rbrkslu", "\xE2\xA6\x90" }, { "rcaron", "\xC5\x99" },
+        { "rcedil", "\xC5\x97" }, { "rceil", "\xE2\x8C\x89" }, { "rcub", "\x7D" }, { "rcy", "\xD1\x80" },
+        { "rdca", "\xE2\xA4\xB7" }, { "rdldhar", "\xE2\xA5\xA9" }, { "rdquo", "\xE2\x80\x9D" },
+        { "rdquor", "\xE2\x80\x9D" }, { "rdsh", "\xE2\x86\xB3" }, { "real", "\xE2\x84\x9C" },
+        { "realine", "\xE2\x84\x9B" }, { "realpart", "\xE2\x84\x9C" }, { "reals", "\xE2\x84\x9D" },
+        { "rect", "\xE2\x96\xAD" }, { "reg", "\xC2\xAE" }, { "rfisht", "\xE2\xA5\xBD" }, { "rfloor", "\xE2\x8C\x8B" },
+        { "rfr", "\xF0\x9D\x94\xAF" }, { "rhard", "\xE2\x87\x81" }, { "rharu", "\xE2\x87\x80" },
+        { "rharul", "\xE2\xA5\xAC" }, { "rho", "\xCF\x81" }, { "rhov", "\xCF\xB1" }, { "rightarrow", "\xE2\x86\x92" },
+        { "rightarrowtail", "\xE2\x86\xA3" }, { "rightharpoondown", "\xE2\x87\x81" },
+        { "rightharpoonup", "\xE2\x87\x80" }, { "rightleftarrows", "\xE2\x87\x84" },
+        { "rightleftharpoons", "\xE2\x87\x8C" }, { "rightrightarrows", "\xE2\x87\x89" },
+        { "rightsquigarrow", "\xE2\x86\x9D" }, { "rightthreetimes", "\xE2\x8B\x8C" }, { "ring", "\xCB\x9A" },
+        { "risingdotseq", "\xE2\x89\x93" }, { "rlarr", "\xE2\x87\x84" }, { "rlhar", "\xE2\x87\x8C" },
+        { "rlm", "\xE2\x80\x8F" }, { "rmoust", "\xE2\x8E\xB1" }, { "rmoustache", "\xE2\x8E\xB1" },
+        { "rnmid", "\xE2\xAB\xAE" }, { "roang", "\xE2\x9F\xAD" }, { "roarr", "\xE2\x87\xBE" },
+        { "robrk", "\xE2\x9F\xA7" }, { "ropar", "\xE2\xA6\x86" }, { "ropf", "\xF0\x9D\x95\xA3" },
+        { "roplus", "\xE2\xA8\xAE" }, { "rotimes", "\xE2\xA8\xB5" }, { "rpar", "\x29" }, { "rpargt", "\xE2\xA6\x94" },
+        { "rppolint", "\xE2\xA8\x92" }, { "rrarr", "\xE2\x87\x89" }, { "rsaquo", "\xE2\x80\xBA" },
+        { "rscr", "\xF0\x9D\x93\x87" }, { "rsh", "\xE2\x86\xB1" }, { "rsqb", "\x5D" }, { "rsquo", "\xE2\x80\x99" },
+        { "rsquor", "\xE2\x80\x99" }, { "rthree", "\xE2\x8B\x8C" }, { "rtimes", "\xE2\x8B\x8A" },
+        { "rtri", "\xE2\x96\xB9" }, { "rtrie", "\xE2\x8A\xB5" }, { "rtrif", "\xE2\x96\xB8" },
+        { "rtriltri", "\xE2\xA7\x8E" }, { "ruluhar", "\xE2\xA5\xA8" }, { "rx", "\xE2\x84\x9E" },
+        { "sacute", "\xC5\x9B" }, { "sbquo", "\xE2\x80\x9A" }, { "sc", "\xE2\x89\xBB" }, { "scE", "\xE2\xAA\xB4" },
+        { "scap", "\xE2\xAA\xB8" }, { "scaron", "\xC5\xA1" }, { "sccue", "\xE2\x89\xBD" }, { "sce", "\xE2\xAA\xB0" },
+        { "scedil", "\xC5\x9F" }, { "scirc", "\xC5\x9D" }, { "scnE", "\xE2\xAA\xB6" }, { "scnap", "\xE2\xAA\xBA" },
+        { "scnsim", "\xE2\x8B\xA9" }, { "scpolint", "\xE2\xA8\x93" }, { "scsim", "\xE2\x89\xBF" },
+        { "scy", "\xD1\x81" }, { "sdot", "\xE2\x8B\x85" }, { "sdotb", "\xE2\x8A\xA1" }, { "sdote", "\xE2\xA9\xA6" },
+        { "seArr", "\xE2\x87\x98" }, { "searhk", "\xE2\xA4\xA5" }, { "searr", "\xE2\x86\x98" },
+        { "searrow", "\xE2\x86\x98" }, { "sect", "\xC2\xA7" }, { "semi", "\x3B" }, { "seswar", "\xE2\xA4\xA9" },
+        { "setminus", "\xE2\x88\x96" }, { "setmn", "\xE2\x88\x96" }, { "sext", "\xE2\x9C\xB6" },
+        { "sfr", "\xF0\x9D\x94\xB0" }, { "sfrown", "\xE2\x8C\xA2" }, { "sharp", "\xE2\x99\xAF" },
+        { "shchcy", "\xD1\x89" }, { "shcy", "\xD1\x88" }, { "shortmid", "\xE2\x88\xA3" },
+        { "shortparallel", "\xE2\x88\xA5" }, { "shy", "\xC2\xAD" }, { "sigma", "\xCF\x83" }, { "sigmaf", "\xCF\x82" },
+        { "sigmav", "\xCF\x82" }, { "sim", "\xE2\x88\xBC" }, { "simdot", "\xE2\xA9\xAA" }, { "sime", "\xE2\x89\x83" },
+        { "simeq", "\xE2\x89\x83" }, { "simg", "\xE2\xAA\x9E" }, { "simgE", "\xE2\xAA\xA0" },
+        { "siml", "\xE2\xAA\x9D" }, { "simlE", "\xE2\xAA\x9F" }, { "simne", "\xE2\x89\x86" },
+        { "simplus", "\xE2\xA8\xA4" }, { "simrarr", "\xE2\xA5\xB2" }, { "slarr", "\xE2\x86\x90" },
+        { "smallsetminus", "\xE2\x88\x96" }, { "smashp", "\xE2\xA8\xB3" }, { "smeparsl", "\xE2\xA7\xA4" },
+        { "smid", "\xE2\x88\xA3" }, { "smile", "\xE2\x8C\xA3" }, { "smt", "\xE2\xAA\xAA" }, { "smte", "\xE2\xAA\xAC" },
+        { "smtes", "\xE2\xAA\xAC\xEF\xB8\x80" }, { "softcy", "\xD1\x8C" }, { "sol", "\x2F" },
+        { "solb", "\xE2\xA7\x84" }, { "solbar", "\xE2\x8C\xBF" }, { "sopf", "\xF0\x9D\x95\xA4" },
+        { "spades", "\xE2\x99\xA0" }, { "spadesuit", "\xE2\x99\xA0" }, { "spar", "\xE2\x88\xA5" },
+        { "sqcap", "\xE2\x8A\x93" }, { "sqcaps", "\xE2\x8A\x93\xEF\xB8\x80" }, { "sqcup", "\xE2\x8A\x94" },
+        { "sqcups", "\xE2\x8A\x94\xEF\xB8\x80" }, { "sqsub", "\xE2\x8A\x8F" }, { "sqsube", "\xE2\x8A\x91" },
+        { "sqsubset", "\xE2\x8A\x8F" }, { "sqsubseteq", "\xE2\x8A\x91" }, { "sqsup", "\xE2\x8A\x90" },
+        { "sqsupe", "\xE2\x8A\x92" }, { "sqsupset", "\xE2\x8A\x90" }, { "sqsupseteq", "\xE2\x8A\x92" },
+        { "squ", "\xE2\x96\xA1" }, { "square", "\xE2\x96\xA1" }, { "squarf", "\xE2\x96\xAA" },
+        { "squf", "\xE2\x96\xAA" }, { "srarr", "\xE2\x86\x92" }, { "sscr", "\xF0\x9D\x93\x88" },
+        { "ssetmn", "\xE2\x88\x96" }, { "ssmile", "\xE2\x8C\xA3" }, { "sstarf", "\xE2\x8B\x86" },
+        { "star", "\xE2\x98\x86" }, { "starf", "\xE2\x98\x85" }, { "straightepsilon", "\xCF\xB5" },
+        { "straightphi", "\xCF\x95" }, { "strns", "\xC2\xAF" }, { "sub", "\xE2\x8A\x82" }, { "subE", "\xE2\xAB\x85" },
+        { "subdot", "\xE2\xAA\xBD" }, { "sube", "\xE2\x8A\x86" }, { "subedot", "\xE2\xAB\x83" },
+        { "submult", "\xE2\xAB\x81" }, { "subnE", "\xE2\xAB\x8B" }, { "subne", "\xE2\x8A\x8A" },
+        { "subplus", "\xE2\xAA\xBF" }, { "subrarr", "\xE2\xA5\xB9" }, { "subset", "\xE2\x8A\x82" },
+        { "subseteq", "\xE2\x8A\x86" }, { "subseteqq", "\xE2\xAB\x85" }, { "subsetneq", "\xE2\x8A\x8A" },
+        { "subsetneqq", "\xE2\xAB\x8B" }, { "subsim", "\xE2\xAB\x87" }, { "subsub", "\xE2\xAB\x95" },
+        { "subsup", "\xE2\xAB\x93" }, { "succ", "\xE2\x89\xBB" }, { "succapprox", "\xE2\xAA\xB8" },
+        { "succcurlyeq", "\xE2\x89\xBD" }, { "succeq", "\xE2\xAA\xB0" }, { "succnapprox", "\xE2\xAA\xBA" },
+        { "succneqq", "\xE2\xAA\xB6" }, { "succnsim", "\xE2\x8B\xA9" }, { "succsim", "\xE2\x89\xBF" },
+        { "sum", "\xE2\x88\x91" }, { "sung", "\xE2\x99\xAA" }, { "sup", "\xE2\x8A\x83" }, { "sup1", "\xC2\xB9" },
+        { "sup2", "\xC2\xB2" }, { "sup3", "\xC2\xB3" }, { "supE", "\xE2\xAB\x86" }, { "supdot", "\xE2\xAA\xBE" },
+        { "supdsub", "\xE2\xAB\x98" }, { "supe", "\xE2\x8A\x87" }, { "supedot", "\xE2\xAB\x84" },
+        { "suphsol", "\xE2\x9F\x89" }, { "suphsub", "\xE2\xAB\x97" }, { "suplarr", "\xE2\xA5\xBB" },
+        { "supmult", "\xE2\xAB\x82" }, { "supnE", "\xE2\xAB\x8C" }, { "supne", "\xE2\x8A\x8B" },
+        { "supplus", "\xE2\xAB\x80" }, { "supset", "\xE2\x8A\x83" }, { "supseteq", "\xE2\x8A\x87" },
+        { "supseteqq", "\xE2\xAB\x86" }, { "supsetneq", "\xE2\x8A\x8B" }, { "supsetneqq", "\xE2\xAB\x8C" },
+        { "supsim", "\xE2\xAB\x88" }, { "supsub", "\xE2\xAB\x94" }, { "supsup", "\xE2\xAB\x96" },
+        { "swArr", "\xE2\x87\x99" }, { "swarhk", "\xE2\xA4\xA6" }, { "swarr", "\xE2\x86\x99" },
+        { "swarrow", "\xE2\x86\x99" }, { "swnwar", "\xE2\xA4\xAA" }, { "szlig", "\xC3\x9F" },
+        { "target", "\xE2\x8C\x96" }, { "tau", "\xCF\x84" }, { "tbrk", "\xE2\x8E\xB4" }, { "tcaron", "\xC5\xA5" },
+        { "tcedil", "\xC5\xA3" }, { "tcy", "\xD1\x82" }, { "tdot", "\xE2\x83\x9B" }, { "telrec", "\xE2\x8C\x95" },
+        { "tfr", "\xF0\x9D\x94\xB1" }, { "there4", "\xE2\x88\xB4" }, { "therefore", "\xE2\x88\xB4" },
+        { "theta", "\xCE\xB8" }, { "thetasym", "\xCF\x91" }, { "thetav", "\xCF\x91" },
+        { "thickapprox", "\xE2\x89\x88" }, { "thicksim", "\xE2\x88\xBC" }, { "thinsp", "\xE2\x80\x89" },
+        { "thkap", "\xE2\x89\x88" }, { "thksim", "\xE2\x88\xBC" }, { "thorn", "\xC3\xBE" }, { "tilde", "\xCB\x9C" },
+        { "times", "\xC3\x97" }, { "timesb", "\xE2\x8A\xA0" }, { "timesbar", "\xE2\xA8\xB1" },
+        { "timesd", "\xE2\xA8\xB0" }, { "tint", "\xE2\x88\xAD" }, { "toea", "\xE2\xA4\xA8" }, { "top", "\xE2\x8A\xA4" },
+        { "topbot", "\xE2\x8C\xB6" }, { "topcir", "\xE2\xAB\xB1" }, { "topf", "\xF0\x9D\x95\xA5" },
+        { "topfork", "\xE2\xAB\x9A" }, { "tosa", "\xE2\xA4\xA9" }, { "tprime", "\xE2\x80\xB4" },
+        { "trade", "\xE2\x84\xA2" }, { "triangle", "\xE2\x96\xB5" }, { "triangledown", "\xE2\x96\xBF" },
+        { "triangleleft", "\xE2\x97\x83" }, { "trianglelefteq", "\xE2\x8A\xB4" }, { "triangleq", "\xE2\x89\x9C" },
+        { "triangleright", "\xE2\x96\xB9" }, { "trianglerighteq", "\xE2\x8A\xB5" }, { "tridot", "\xE2\x97\xAC" },
+        { "trie", "\xE2\x89\x9C" }, { "triminus", "\xE2\xA8\xBA" }, { "triplus", "\xE2\xA8\xB9" },
+        { "trisb", "\xE2\xA7\x8D" }, { "tritime", "\xE2\xA8\xBB" }, { "trpezium", "\xE2\x8F\xA2" },
+        { "tscr", "\xF0\x9D\x93\x89" }, { "tscy", "\xD1\x86" }, { "tshcy", "\xD1\x9B" }, { "tstrok", "\xC5\xA7" },
+        { "twixt", "\xE2\x89\xAC" }, { "twoheadleftarrow", "\xE2\x86\x9E" }, { "twoheadrightarrow", "\xE2\x86\xA0" },
+        { "uArr", "\xE2\x87\x91" }, { "uHar", "\xE2\xA5\xA3" }, { "uacute", "\xC3\xBA" }, { "uarr", "\xE2\x86\x91" },
+        { "ubrcy", "\xD1\x9E" }, { "ubreve", "\xC5\xAD" }, { "ucirc", "\xC3\xBB" }, { "ucy", "\xD1\x83" },
+        { "udarr", "\xE2\x87\x85" }, { "udblac", "\xC5\xB1" }, { "udhar", "\xE2\xA5\xAE" },
+        { "ufisht", "\xE2\xA5\xBE" }, { "ufr", "\xF0\x9D\x94\xB2" }, { "ugrave", "\xC3\xB9" },
+        { "uharl", "\xE2\x86\xBF" }, { "uharr", "\xE2\x86\xBE" }, { "uhblk", "\xE2\x96\x80" },
+        { "ulcorn", "\xE2\x8C\x9C" }, { "ulcorner", "\xE2\x8C\x9C" }, { "ulcrop", "\xE2\x8C\x8F" },
+        { "ultri", "\xE2\x97\xB8" }, { "umacr", "\xC5\xAB" }, { "uml", "\xC2\xA8" }, { "uogon", "\xC5\xB3" },
+        { "uopf", "\xF0\x9D\x95\xA6" }, { "uparrow", "\xE2\x86\x91" }, { "updownarrow", "\xE2\x86\x95" },
+        { "upharpoonleft", "\xE2\x86\xBF" }, { "upharpoonright", "\xE2\x86\xBE" }, { "uplus", "\xE2\x8A\x8E" },
+        { "upsi", "\xCF\x85" }, { "upsih", "\xCF\x92" }, { "upsilon", "\xCF\x85" }, { "upuparrows", "\xE2\x87\x88" },
+        { "urcorn", "\xE2\x8C\x9D" }, { "urcorner", "\xE2\x8C\x9D" }, { "urcrop", "\xE2\x8C\x8E" },
+        { "uring", "\xC5\xAF" }, { "urtri", "\xE2\x97\xB9" }, { "uscr", "\xF0\x9D\x93\x8A" },
+        { "utdot", "\xE2\x8B\xB0" }, { "utilde", "\xC5\xA9" }, { "utri", "\xE2\x96\xB5" }, { "utrif", "\xE2\x96\xB4" },
+        { "uuarr", "\xE2\x87\x88" }, { "uuml", "\xC3\xBC" }, { "uwangle", "\xE2\xA6\xA7" }, { "vArr", "\xE2\x87\x95" },
+        { "vBar", "\xE2\xAB\xA8" }, { "vBarv", "\xE2\xAB\xA9" }, { "vDash", "\xE2\x8A\xA8" },
+        { "vangrt", "\xE2\xA6\x9C" }, { "varepsilon", "\xCF\xB5" }, { "varkappa", "\xCF\xB0" },
+        { "varnothing", "\xE2\x88\x85" }, { "varphi", "\xCF\x95" }, { "varpi", "\xCF\x96" },
+        { "varpropto", "\xE2\x88\x9D" }, { "varr", "\xE2\x86\x95" }, { "varrho", "\xCF\xB1" },
+        { "varsigma", "\xCF\x82" }, { "varsubsetneq", "\xE2\x8A\x8A\xEF\xB8\x80" },
+        { "varsubsetneqq", "\xE2\xAB\x8B\xEF\xB8\x80" }, { "varsupsetneq", "\xE2\x8A\x8B\xEF\xB8\x80" },
+        { "varsupsetneqq", "\xE2\xAB\x8C\xEF\xB8\x80" }, { "vartheta", "\xCF\x91" },
+        { "vartriangleleft", "\xE2\x8A\xB2" }, { "vartriangleright", "\xE2\x8A\xB3" }, { "vcy", "\xD0\xB2" },
+        { "vdash", "\xE2\x8A\xA2" }, { "vee", "\xE2\x88\xA8" }, { "veebar", "\xE2\x8A\xBB" },
+        { "veeeq", "\xE2\x89\x9A" }, { "vellip", "\xE2\x8B\xAE" }, { "verbar", "\x7C" }, { "vert", "\x7C" },
+        { "vfr", "\xF0\x9D\x94\xB3" }, { "vltri", "\xE2\x8A\xB2" }, { "vnsub", "\xE2\x8A\x82\xE2\x83\x92" },
+        { "vnsup", "\xE2\x8A\x83\xE2\x83\x92" }, { "vopf", "\xF0\x9D\x95\xA7" }, { "vprop", "\xE2\x88\x9D" },
+        { "vrtri", "\xE2\x8A\xB3" }, { "vscr", "\xF0\x9D\x93\x8B" }, { "vsubnE", "\xE2\xAB\x8B\xEF\xB8\x80" },
+        { "vsubne", "\xE2\x8A\x8A\xEF\xB8\x80" }, { "vsupnE", "\xE2\xAB\x8C\xEF\xB8\x80" },
+        { "vsupne", "\xE2\x8A\x8B\xEF\xB8\x80" }, { "vzigzag", "\xE2\xA6\x9A" }, { "wcirc", "\xC5\xB5" },
+        { "wedbar", "\xE2\xA9\x9F" }, { "wedge", "\xE2\x88\xA7" }, { "wedgeq", "\xE2\x89\x99" },
+        { "weierp", "\xE2\x84\x98" }, { "wfr", "\xF0\x9D\x94\xB4" }, { "wopf", "\xF0\x9D\x95\xA8" },
+        { "wp", "\xE2\x84\x98" }, { "wr", "\xE2\x89\x80" }, { "wreath", "\xE2\x89\x80" },
+        { "wscr", "\xF0\x9D\x93\x8C" }, { "xcap", "\xE2\x8B\x82" }, { "xcirc", "\xE2\x97\xAF" },
+        { "xcup", "\xE2\x8B\x83" }, { "xdtri", "\xE2\x96\xBD" }, { "xfr", "\xF0\x9D\x94\xB5" },
+        { "xhArr", "\xE2\x9F\xBA" }, { "xharr", "\xE2\x9F\xB7" }, { "xi", "\xCE\xBE" }, { "xlArr", "\xE2\x9F\xB8" },
+        { "xlarr", "\xE2\x9F\xB5" }, { "xmap", "\xE2\x9F\xBC" }, { "xnis", "\xE2\x8B\xBB" },
+        { "xodot", "\xE2\xA8\x80" }, { "xopf", "\xF0\x9D\x95\xA9" }, { "xoplus", "\xE2\xA8\x81" },
+        { "xotime", "\xE2\xA8\x82" }, { "xrArr", "\xE2\x9F\xB9" }, { "xrarr", "\xE2\x9F\xB6" },
+        { "xscr", "\xF0\x9D\x93\x8D" }, { "xsqcup", "\xE2\xA8\x86" }, { "xuplus", "\xE2\xA8\x84" },
+        { "xutri", "\xE2\x96\xB3" }, { "xvee", "\xE2\x8B\x81" }, { "xwedge", "\xE2\x8B\x80" }, { "yacute", "\xC3\xBD" },
+        { "yacy", "\xD1\x8F" }, { "ycirc", "\xC5\xB7" }, { "ycy", "\xD1\x8B" }, { "yen", "\xC2\xA5" },
+        { "yfr", "\xF0\x9D\x94\xB6" }, { "yicy", "\xD1\x97" }, { "yopf", "\xF0\x9D\x95\xAA" },
+        { "yscr", "\xF0\x9D\x93\x8E" }, { "yucy", "\xD1\x8E" }, { "yuml", "\xC3\xBF" }, { "zacute", "\xC5\xBA" },
+        { "zcaron", "\xC5\xBE" }, { "zcy", "\xD0\xB7" }, { "zdot", "\xC5\xBC" }, { "zeetrf", "\xE2\x84\xA8" },
+        { "zeta", "\xCE\xB6" }, { "zfr", "\xF0\x9D\x94\xB7" }, { "zhcy", "\xD0\xB6" }, { "zigrarr", "\xE2\x87\x9D" },
+        { "zopf", "\xF0\x9D\x95\xAB" }, { "zscr", "\xF0\x9D\x93\x8F" }, { "zwj", "\xE2\x80\x8D" },
+        { "zwnj", "\xE2\x80\x8C" },
+    };
+};
+
+static_assert(HTMLEntities::isValid(), "HTMLEntities table must be sorted, within kMaxLength and kMaxUTF8, and never grow when decoded");
+
+// Feed timestamps to Unix time, without allocating. Handles RFC 822 as RSS
+// uses it ("Wed, 02 Oct 2002 13:00:00 GMT", numeric or named zones, with or
+// without weekday and seconds, two-digit years) and the ISO 8601 profile of
+// Atom and dc:date ("2002-10-02T10:00:00.25-05:00"). Returns 0 for anything
+// else. A zone with no offset, or one not in kZones, is taken as UTC.
+class FeedDate {
+public:
+    static int64_t parse(string_view text) {
+        size_t pos = 0;
+        skipSpace(text, pos);
+        if (pos + 4 < text.size() && text[pos + 4] == '-' && isDigit(text[pos])) return parseISO(text, pos);
+        return parseRFC822(text, pos);
+    }
+
+    // Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's
+    // days_from_civil)
+    static constexpr int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+        y -= m <= 2;
+        int64_t era = (y >= 0 ? y : y - 399) / 400;
+        unsigned yoe = static_cast<unsigned>(y - era * 400);
+        unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<int64_t>(doe) - 719468;
+    }
+
+private:
+    struct Zone {
+        const char* name;
+        int minutes;   // east of UTC
+    };
+
+    static constexpr Zone kZones[] = {
+        { "GMT", 0 }, { "UT", 0 }, { "UTC", 0 }, { "Z", 0 },
+        { "EST", -300 }, { "EDT", -240 }, { "CST", -360 }, { "CDT", -300 },
+        { "MST", -420 }, { "MDT", -360 }, { "PST", -480 }, { "PDT", -420 },
+        { "BST", 60 }, { "CET", 60 }, { "CEST", 120 }, { "EET", 120 }, { "EEST", 180 },
+        { "WAT", 60 }, { "CAT", 120 }, { "EAT", 180 }, { "SAST", 120 },
+        { "IST", 330 }, { "HKT", 480 }, { "SGT", 480 }, { "JST", 540 },
+        { "AEST", 600 }, { "AEDT", 660 },
+    };
+
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+    static bool isAlpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+    static char upper(char c) { return c >= 'a' && c <= 'z' ? c - 32 : c; }
+
+    static void skipSpace(string_view text, size_t& pos) {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || text[pos] == '\n')) pos++;
+    }
+
+    // Reads between minDigits and maxDigits digits; -1 if there are fewer
+    static int readNumber(string_view text, size_t& pos, size_t minDigits, size_t maxDigits) {
+        int value = 0;
+        size_t start = pos;
+        while (pos < text.size() && pos - start < maxDigits && isDigit(text[pos])) value = value * 10 + (text[pos++] - '0');
+        return pos - start < minDigits ? -1 : value;
+    }
+
+    static bool expect(string_view text, size_t& pos, char c) {
+        if (pos >= text.size() || text[pos] != c) return false;
+        pos++;
+        return true;
+    }
+
+    // "Jan".."Dec", any case, longer names accepted; 0 if not a month
+    static int readMonth(string_view text, size_t& pos) {
+        if (pos + 3 > text.size()) return 0;
+        uint32_t key = (uint32_t)upper(text[pos]) << 16 | (uint32_t)upper(text[pos + 1]) << 8 | (uint32_t)upper(text[pos + 2]);
+        static constexpr char kMonths[] = "JANFEBMARAPRMAYJUNJULAUGSEPOCTNOVDEC";
+        for (int m = 0; m < 12; m++) {
+            const char* name = kMonths + m * 3;
+            if (key == ((uint32_t)name[0] << 16 | (uint32_t)name[1] << 8 | (uint32_t)name[2])) {
+                pos += 3;
+                while (pos < text.size() && isAlpha(text[pos])) pos++;
+                return m + 1;
+            }
+        }
+        return 0;
+    }
+
+    // Offset in minutes east of UTC for "+hhmm", "-hh:mm", "+hh" or a zone
+    // name. A feed keeps using the one zone, so the last name looked up on
+    // this thread is remembered and repeat lookups skip the table.
+    static int readZone(string_view text, size_t& pos) {
+        skipSpace(text, pos);
+        if (pos >= text.size()) return 0;
+
+        char sign = text[pos];
+        if (sign == '+' || sign == '-') {
+            pos++;
+            int hours = readNumber(text, pos, 2, 2);
+            if (hours < 0) return 0;
+            expect(text, pos, ':');
+            int minutes = readNumber(text, pos, 2, 2);
+            int offset = hours * 60 + max(minutes, 0);
+            return sign == '-' ? -offset : offset;
+        }
+
+        uint32_t key = 0;
+        size_t length = 0;
+        while (pos < text.size() && isAlpha(text[pos])) {
+            if (length++ < 4) key = key << 8 | (uint8_t)upper(text[pos]);
+            pos++;
+        }
+        if (length == 0 || length > 4) return 0;
+
+        struct Cached {
+            uint32_t key;
+            int minutes;
+        };
+        thread_local Cached last = { 'G' << 16 | 'M' << 8 | 'T', 0 };
+        if (key == last.key) return last.minutes;
+
+        int minutes = 0;
+        for (const Zone& zone : kZones) {
+            uint32_t zoneKey = 0;
+            for (const char* c = zone.name; *c; c++) zoneKey = zoneKey << 8 | (uint8_t)*c;
+            if (zoneKey == key) {
+                minutes = zone.minutes;
+                break;
+            }
+        }
+        last = { key, minutes };
+        return minutes;
+    }
+
+    static int64_t toEpoch(int year, int month, int day, int hour, int minute, int second, int zoneMinutes) {
+        if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 24 || minute > 59 || second > 60) return 0;
+        int64_t days = daysFromCivil(year, month, day);
+        return days * 86400 + hour * 3600 + minute * 60 + second - zoneMinutes * 60;
+    }
+
+    // [Wed,] 2 Oct 2002 13:00[:00] zone
+    static int64_t parseRFC822(string_view text, size_t pos) {
+        if (pos < text.size() && isAlpha(text[pos])) {
+            while (pos < text.size() && isAlpha(text[pos])) pos++;
+            expect(text, pos, ',');
+            skipSpace(text, pos);
+        }
+
+        int day = readNumber(text, pos, 1, 2);
+        if (day < 0 || !(expect(text, pos, ' ') || expect(text, pos, '-'))) return 0;
+        skipSpace(text, pos);
+        int month = readMonth(text, pos);
+        if (!month || !(expect(text, pos, ' ') || expect(text, pos, '-'))) return 0;
+        skipSpace(text, pos);
+
+        size_t yearStart = pos;
+        int year = readNumber(text, pos, 2, 4);
+        if (year < 0 || pos - yearStart == 3) return 0;
+        if (pos - yearStart == 2) year += year < 50 ? 2000 : 1900;
+
+        skipSpace(text, pos);
+        int hour = readNumber(text, pos, 1, 2);
+        if (hour < 0 || !expect(text, pos, ':')) return 0;
+        int minute = readNumber(text, pos, 2, 2);
+        if (minute < 0) return 0;
+        int second = 0;
+        if (expect(text, pos, ':')) {
+            second = readNumber(text, pos, 2, 2);
+            if (second < 0) return 0;
+        }
+
+        return toEpoch(year, month, day, hour, minute, second, readZone(text, pos));
+    }
+
+    // 2002-10-02[(T| )10:00[:00[.frac]]][Z|(+|-)hh[:mm]]
+    static int64_t parseISO(string_view text, size_t pos) {
+        int year = readNumber(text, pos, 4, 4);
+        if (year < 0 || !expect(text, pos, '-')) return 0;
+        int month = readNumber(text, pos, 2, 2);
+        if (month < 0 || !expect(text, pos, '-')) return 0;
+        int day = readNumber(text, pos, 2, 2);
+        if (day < 0) return 0;
+
+        int hour = 0, minute = 0, second = 0;
+        if (expect(text, pos, 'T') || expect(text, pos, 't') || expect(text, pos, ' ')) {
+            hour = readNumber(text, pos, 2, 2);
+            if (hour < 0 || !expect(text, pos, ':')) return 0;
+            minute = readNumber(text, pos, 2, 2);
+            if (minute < 0) return 0;
+            if (expect(text, pos, ':')) {
+                second = readNumber(text, pos, 2, 2);
+                if (second < 0) return 0;
+                if (expect(text, pos, '.') || expect(text, pos, ',')) {
+                    while (pos < text.size() && isDigit(text[pos])) pos++;
+                }
+            }
+        }
+
+        return toEpoch(year, month, day, hour, minute, second, readZone(text, pos));
+    }
+};
+
+static_assert(FeedDate::daysFromCivil(1970, 1, 1) == 0 && FeedDate::daysFromCivil(2000, 3, 1) == 11017,
+    "daysFromCivil must count from the Unix epoch");
+
+// Simple XML parser. Fields are located as views into the fetched document and
+// copied exactly once, already cleaned, into the item that keeps them.
 class XMLParser {
 public:
-    static string extractTag(const string& xml, const string& tag) {
-        string startTag = "<" + tag + ">";
-        string endTag = "</" + tag + ">";
+    // Content of the first <tag>...</tag>, as a view into xml
+    static string_view extractTag(string_view xml, string_view tag) {
+        size_t start = findTag(xml, 0, tag, false);
+        if (start == string_view::npos) return {};
 
-        size_t start = xml.find(startTag);
-        if (start == string::npos) return "";
-
-        start += startTag.length();
-        size_t end = xml.find(endTag, start);
-        if (end == string::npos) return "";
+        start += tag.length() + 2;
+        size_t end = findTag(xml, start, tag, true);
+        if (end == string_view::npos) return {};
 
         return xml.substr(start, end - start);
     }
 
-    static string extractAttribute(const string& xml, const string& tag, const string& attr) {
-        size_t tagPos = xml.find("<" + tag);
-        if (tagPos == string::npos) return "";
-
-        size_t endTag = xml.find(">", tagPos);
-        if (endTag == string::npos) return "";
-
-        string tagContent = xml.substr(tagPos, endTag - tagPos);
-
-        size_t attrPos = tagContent.find(attr + "=\"");
-        if (attrPos == string::npos) {
-            attrPos = tagContent.find(attr + "='");
-            if (attrPos == string::npos) return "";
-        }
-
-        size_t startQuote = tagContent.find("\"", attrPos);
-        if (startQuote == string::npos) startQuote = tagContent.find("'", attrPos);
-        if (startQuote == string::npos) return "";
+    static string_view extractAttribute(string_view xml, string_view tag, string_view attr) {
+        size_t tagPos = findTagPrefix(xml, tag);
+        if (tagPos == string_view::npos) return {};
 
-        size_t endQuote = tagContent.find("\"", startQuote + 1);
-        if (endQuote == string::npos) endQuote = tagContent.find("'", startQuote + 1);
-        if (endQuote == string::npos) return "";
+        size_t endTag = xml.find('>', tagPos);
+        if (endTag == string_view::npos) return {};
 
-        return tagContent.substr(startQuote + 1, endQuote - startQuote - 1);
+        return FeedTokenizer::attribute(xml.substr(tagPos, endTag - tagPos), attr);
     }
 
-    static string extractImageURL(const string& itemXML) {
+    // Picks among the image candidates the tokenizer collected on its way
+    // through the item. The one exception is the last resort, an <img> in
+    // the description: the tokenizer steps over description CDATA without
+    // reading it, and looking for <img> there would mean scanning every
+    // description, so only items without a media tag pay for that scan here.
+    static string extractImageURL(const FeedTokenizer::RawItem& raw) {
         // Try media:content url
-        string mediaContent = extractAttribute(itemXML, "media:content", "url");
-        if (!mediaContent.empty()) return mediaContent;
+        string_view url = FeedTokenizer::attribute(raw.mediaContent, "url");
+        if (!url.empty()) return string(url);
 
         // Try media:thumbnail url
-        string mediaThumbnail = extractAttribute(itemXML, "media:thumbnail", "url");
-        if (!mediaThumbnail.empty()) return mediaThumbnail;
+        url = FeedTokenizer::attribute(raw.mediaThumbnail, "url");
+        if (!url.empty()) return string(url);
 
         // Try enclosure url
-        string enclosure = extractAttribute(itemXML, "enclosure", "url");
-        if (!enclosure.empty() && (enclosure.find(".jpg") != string::npos ||
-            enclosure.find(".png") != string::npos ||
-            enclosure.find(".jpeg") != string::npos ||
-            enclosure.find(".webp") != string::npos)) {
-            return enclosure;
+        url = FeedTokenizer::attribute(raw.enclosure, "url");
+        if (!url.empty() && (url.find(".jpg") != string_view::npos ||
+            url.find(".png") != string_view::npos ||
+            url.find(".jpeg") != string_view::npos ||
+            url.find(".webp") != string_view::npos)) {
+            return string(url);
         }
 
         // Try to extract image from description HTML
-        string description = extractTag(itemXML, "description");
-        size_t imgPos = description.find("<img");
-        if (imgPos != string::npos) {
-            string imgTag = description.substr(imgPos, description.find(">", imgPos) - imgPos);
-            string srcUrl = extractAttribute("<" + imgTag + ">", "img", "src");
-            if (!srcUrl.empty()) return srcUrl;
-        }
+        return string(extractAttribute(raw.description, "img", "src"));
+    }
 
-        return "";
+    // Plain text from a field, in one allocation and linear time. The first
+    // sweep copies the field out of the document, unwrapping every CDATA
+    // section and decoding XML references, which yields the HTML the publisher
+    // meant. The second sweep runs in place over that copy, dropping tags and
+    // decoding HTML named and numeric references.
+    static string cleanText(string_view text) {
+        string result(text.size(), '\0');
+        char* out = result.data();
+        size_t length = unwrapXML(text, out);
+        length = stripHTML(out, length);
+
+        // FIX: Cast to unsigned char to handle UTF-8 and avoid assertion failures
+        size_t start = 0;
+        while (start < length && isspace(static_cast<unsigned char>(out[start]))) start++;
+        while (length > start && isspace(static_cast<unsigned char>(out[length - 1]))) length--;
+
+        result.resize(length);
+        result.erase(0, start);
+        return result;
     }
 
-    static string cleanText(string text) {
-        // Remove CDATA
-        size_t cdataStart = text.find("<![CDATA[");
-        if (cdataStart != string::npos) {
-            size_t cdataEnd = text.find("]]>", cdataStart);
-            if (cdataEnd != string::npos) {
-                text = text.substr(cdataStart + 9, cdataEnd - cdataStart - 9);
+    static constexpr size_t kMaxItems = 30;                  // per feed
+    static constexpr size_t kParallelBytes = 512 * 1024;     // documents smaller than this parse serially
+    static constexpr size_t kParallelChunkItems = 8;
+
+    // knownItems, if given, holds the feed's items from the previous fetch by
+    // guid. Items found there are carried over by pointer without running the
+    // field extraction again; on return it holds this document's items.
+    //
+    // The tokenizer pass picks the items, in document order, and cleans their
+    // titles (an empty title drops the item, so the cap needs them). The rest
+    // of each new item's fields, where nearly all the cleaning time goes, is
+    // then filled in. For documents of kParallelBytes or more, and given a
+    // pool, that happens in runs of kParallelChunkItems items spread over the
+    // pool, and each item keeps its slot.
+    static FeedItems parseRSS(string_view xml, const string& source, const string& category, const string& country,
+        ItemIndex* knownItems = nullptr, WorkerPool* pool = nullptr, size_t maxItems = kMaxItems) {
+        struct Pending {
+            NewsItem* item;
+            FeedTokenizer::RawItem raw;
+        };
+
+        FeedItems items;
+        vector<Pending> pending;
+        ItemIndex current;
+
+        FeedTokenizer::forEachItem(xml, [&](const FeedTokenizer::RawItem& raw) {
+            uint64_t key = 0;
+            if (knownItems) {
+                string_view guid = trimmed(raw.guid);
+                if (guid.empty()) guid = trimmed(raw.link);
+                if (!guid.empty()) key = ContentHash::hash64(guid);
             }
-        }
 
-        // Remove HTML tags
-        size_t pos = 0;
-        while ((pos = text.find('<')) != string::npos) {
-            size_t end = text.find('>', pos);
-            if (end == string::npos) break;
-            text.erase(pos, end - pos + 1);
+            if (key) {
+                auto known = knownItems->find(key);
+                if (known != knownItems->end()) {
+                    items.push_back(known->second);
+                    current.emplace(key, known->second);
+                    return items.size() < maxItems;
+                }
+            }
+
+            auto item = make_shared<NewsItem>();
+            item->title = cleanText(raw.title);
+            if (!item->title.empty()) {
+                item->source = source;
+                item->category = category;
+                item->country = country;
+                pending.push_back({ item.get(), raw });
+
+                if (key) current.emplace(key, item);
+                items.push_back(move(item));
+            }
+
+            return items.size() < maxItems;
+            });
+
+        if (pool && xml.size() >= kParallelBytes && pending.size() > kParallelChunkItems) {
+            size_t chunks = (pending.size() + kParallelChunkItems - 1) / kParallelChunkItems;
+            pool->parallelFor(chunks, [&](size_t chunk) {
+                Trace::Span span("fill items", "chunk", (int64_t)chunk);
+                size_t end = min(pending.size(), (chunk + 1) * kParallelChunkItems);
+                for (size_t i = chunk * kParallelChunkItems; i < end; i++) fillItem(*pending[i].item, pending[i].raw);
+                });
+        }
+        else {
+            for (const Pending& p : pending) fillItem(*p.item, p.raw);
         }
 
-        // Replace entities
-        replaceAll(text, "&amp;", "&");
-        replaceAll(text, "&lt;", "<");
-        replaceAll(text, "&gt;", ">");
-        replaceAll(text, "&quot;", "\"");
-        replaceAll(text, "&#39;", "'");
-        replaceAll(text, "&apos;", "'");
+        if (knownItems) *knownItems = move(current);
+        return items;
+    }
 
-        return trim(text);
+private:
+    static void fillItem(NewsItem& item, const FeedTokenizer::RawItem& raw) {
+        item.link = cleanText(raw.link);
+        item.description = cleanText(raw.description);
+        item.pubDate = cleanText(raw.pubDate);
+        item.published = FeedDate::parse(item.pubDate);
+        item.imageUrl = extractImageURL(raw);
     }
 
-    static vector<unordered_map<string, string>> parseRSS(const string& xml, const string& source, const string& category, const string& country) {
-        vector<unordered_map<string, string>> items;
+    // Position of "<tag>" (or "</tag>" when closing) at or after from
+    static size_t findTag(string_view xml, size_t from, string_view tag, bool closing) {
+        size_t nameOffset = closing ? 2 : 1;
+        size_t pos = from;
+        while ((pos = xml.find('<', pos)) != string_view::npos) {
+            size_t after = pos + nameOffset + tag.length();
+            if (after < xml.size() && xml[after] == '>' && (!closing || xml[pos + 1] == '/') &&
+                xml.compare(pos + nameOffset, tag.length(), tag) == 0) {
+                return pos;
+            }
+            pos++;
+        }
+        return string_view::npos;
+    }
 
+    // Position of "<tag" (any continuation, as with attributes)
+    static size_t findTagPrefix(string_view xml, string_view tag) {
         size_t pos = 0;
-        while ((pos = xml.find("<item>", pos)) != string::npos) {
-            size_t end = xml.find("</item>", pos);
-            if (end == string::npos) break;
-
-            string itemXML = xml.substr(pos, end - pos);
+        while ((pos = xml.find('<', pos)) != string_view::npos) {
+            if (xml.compare(pos + 1, tag.length(), tag) == 0) return pos;
+            pos++;
+        }
+        return string_view::npos;
+    }
 
-            unordered_map<string, string> item;
-            item["title"] = cleanText(extractTag(itemXML, "title"));
-            item["link"] = cleanText(extractTag(itemXML, "link"));
-            item["description"] = cleanText(extractTag(itemXML, "description"));
-            item["pubDate"] = cleanText(extractTag(itemXML, "pubDate"));
-            item["source"] = source;
-            item["category"] = category;
-            item["country"] = country;
-            item["imageUrl"] = extractImageURL(itemXML);
+    // Copies text to out (at least text.size() bytes); returns bytes written
+    static size_t unwrapXML(string_view text, char* out) {
+        size_t written = 0;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t special = ByteScan::findEither(text, pos, '<', '&');
+            if (special == string_view::npos) special = text.size();
+            memcpy(out + written, text.data() + pos, special - pos);
+            written += special - pos;
+            pos = special;
+            if (pos == text.size()) break;
 
-            if (!item["title"].empty()) {
-                items.push_back(item);
+            if (text[pos] == '<' && text.compare(pos, 9, "<![CDATA[") == 0) {
+                size_t end = ByteScan::findCDataEnd(text, pos + 9);
+                if (end == string_view::npos) end = text.size();
+                memcpy(out + written, text.data() + pos + 9, end - pos - 9);
+                written += end - pos - 9;
+                pos = min(end + 3, text.size());
+                continue;
             }
 
-            pos = end + 7;
-            if (items.size() >= 30) break; // Limit to 30 per feed
+            size_t consumed = 0;
+            size_t decoded = text[pos] == '&' ? HTMLEntities::decode(text, pos, true, out + written, consumed) : 0;
+            if (decoded) {
+                written += decoded;
+                pos += consumed;
+            }
+            else {
+                out[written++] = text[pos++];
+            }
         }
+        return written;
+    }
 
-        return items;
+    static bool opensTag(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '/' || c == '!' || c == '?';
     }
 
-private:
-    static void replaceAll(string& str, const string& from, const string& to) {
+    // Drops tags and decodes references within buf[0, length); returns the new
+    // length. Output never overtakes input, so this works in place.
+    static size_t stripHTML(char* buf, size_t length) {
+        string_view text(buf, length);
+        size_t written = 0;
         size_t pos = 0;
-        while ((pos = str.find(from, pos)) != string::npos) {
-            str.replace(pos, from.length(), to);
-            pos += to.length();
+        while (pos < length) {
+            size_t special = ByteScan::findEither(text, pos, '<', '&');
+            if (special == string_view::npos) special = length;
+            if (written != pos) memmove(buf + written, buf + pos, special - pos);
+            written += special - pos;
+            pos = special;
+            if (pos == length) break;
+
+            char c = buf[pos];
+            // Only '<' followed by a name, '/', '!' or '?' opens a tag; "a < b" is text
+            if (c == '<' && pos + 1 < length && opensTag(buf[pos + 1])) {
+                size_t close = ByteScan::find(text, pos, '>');
+                if (close == string_view::npos) {
+                    // Unterminated tag: keep the rest as text
+                    memmove(buf + written, buf + pos, length - pos);
+                    return written + length - pos;
+                }
+                pos = close + 1;
+                continue;
+            }
+
+            if (c == '&') {
+                char decoded[HTMLEntities::kMaxUTF8];
+                size_t consumed = 0;
+                size_t n = HTMLEntities::decode(text, pos, false, decoded, consumed);
+                if (n) {
+                    memcpy(buf + written, decoded, n);
+                    written += n;
+                    pos += consumed;
+                    continue;
+                }
+            }
+
+            buf[written++] = c;
+            pos++;
         }
+        return written;
     }
 
-    static string trim(const string& str) {
+    static string_view trimmed(string_view str) {
         size_t start = 0;
         size_t end = str.length();
 
@@ -242,6 +3130,7 @@ private:
 
         return str.substr(start, end - start);
     }
+
 };
 
 // Feed structure
@@ -252,80 +3141,444 @@ struct Feed {
     string country;
 };
 
+// Per-feed refresh cadence, learned from how often new items show up
+struct FeedSchedule {
+    static constexpr chrono::seconds kMinInterval{ 5 * 60 };
+    static constexpr chrono::seconds kMaxInterval{ 6 * 60 * 60 };
+    static constexpr chrono::seconds kDefaultInterval{ 60 * 60 };
+
+    chrono::seconds interval = kDefaultInterval;
+    chrono::steady_clock::time_point lastFetch{};
+    unordered_set<string> seenLinks;
+    bool seeded = false;
+
+    // Returns how many items were not seen on the previous fetch and folds the
+    // observed gap into the interval estimate (EWMA, alpha = 0.3)
+    size_t observe(const FeedItems& items, chrono::steady_clock::time_point now) {
+        size_t newItems = 0;
+        unordered_set<string> links;
+        for (const auto& item : items) {
+            if (item->link.empty()) continue;
+            if (!seenLinks.count(item->link)) newItems++;
+            links.insert(item->link);
+        }
+
+        if (seeded && lastFetch != chrono::steady_clock::time_point{}) {
+            double elapsed = chrono::duration<double>(now - lastFetch).count();
+            // Nothing new means the cadence is at least twice what we waited
+            double sample = newItems > 0 ? elapsed / newItems : elapsed * 2;
+            double next = 0.7 * interval.count() + 0.3 * sample;
+            next = clamp(next, (double)kMinInterval.count(), (double)kMaxInterval.count());
+            interval = chrono::seconds((long long)next);
+        }
+
+        if (!items.empty()) {
+            seenLinks = move(links);
+            seeded = true;
+        }
+        lastFetch = now;
+        return newItems;
+    }
+};
+
+// The last kSamples values of one measurement, for rolling percentiles
+struct RollingSamples {
+    static constexpr size_t kSamples = 32;
+
+    array<double, kSamples> values{};   // ring buffer
+    size_t count = 0;                   // ever added
+
+    void add(double value) {
+        values[count++ % kSamples] = value;
+    }
+
+    double percentile(double q) const {
+        size_t n = min(count, kSamples);
+        if (n == 0) return 0;
+        array<double, kSamples> sorted = values;
+        size_t k = min(n - 1, (size_t)(q * n));
+        nth_element(sorted.begin(), sorted.begin() + k, sorted.begin() + n);
+        return sorted[k];
+    }
+};
+
+// Per-feed success/latency record and circuit breaker. Timeouts follow the
+// observed p99 so a dead feed stops holding a transfer slot for 30s, and after
+// kFailuresToOpen consecutive failures the feed is not fetched at all until its
+// backoff expires and a single probe request succeeds.
+struct FeedHealth {
+    enum class State { Closed, Open, HalfOpen };
+
+    static constexpr size_t kMinSamples = 5;
+    static constexpr long kMinTimeoutMs = 5000;
+    static constexpr long kMaxTimeoutMs = 30000;
+    static constexpr int kFailuresToOpen = 3;
+    static constexpr chrono::seconds kBaseBackoff{ 60 };
+    static constexpr chrono::seconds kMaxBackoff{ 6 * 60 * 60 };
+
+    State state = State::Closed;
+    size_t successes = 0;
+    size_t failures = 0;
+    int consecutiveFailures = 0;
+    int trips = 0;
+    chrono::steady_clock::time_point openUntil{};
+
+    RollingSamples latencies;   // seconds
+
+    // Closed: always. Open: only once the backoff has expired, which moves the
+    // feed to half-open and lets exactly one probe through.
+    bool allowRequest(chrono::steady_clock::time_point now) {
+        if (state == State::Closed) return true;
+        if (state == State::Open && now >= openUntil) {
+            state = State::HalfOpen;
+            return true;
+        }
+        return false;
+    }
+
+    void recordSuccess(double latency) {
+        latencies.add(latency);
+        successes++;
+        consecutiveFailures = 0;
+        trips = 0;
+        state = State::Closed;
+    }
+
+    // Returns true if this failure tripped the breaker open
+    bool recordFailure(chrono::steady_clock::time_point now) {
+        failures++;
+        consecutiveFailures++;
+        if (state != State::HalfOpen && consecutiveFailures < kFailuresToOpen) return false;
+
+        auto backoff = kBaseBackoff * (1LL << min(trips, 16));
+        trips++;
+        openUntil = now + min<chrono::seconds>(backoff, kMaxBackoff);
+        state = State::Open;
+        return true;
+    }
+
+    double percentile(double q) const {
+        return latencies.percentile(q);
+    }
+
+    // 3x the observed p99, until there is enough history to trust it
+    long timeoutMs() const {
+        if (latencies.count < kMinSamples) return kMaxTimeoutMs;
+        return clamp((long)(percentile(0.99) * 3000), kMinTimeoutMs, kMaxTimeoutMs);
+    }
+
+    const char* stateName() const {
+        switch (state) {
+        case State::Closed: return "closed";
+        case State::Open: return "open";
+        default: return "half-open";
+        }
+    }
+};
+
+// Where a feed's time goes: curl's phases for every transfer, and parse time
+// and item count for every body actually parsed (not served from the body
+// cache). Latest values plus rolling percentiles, all in milliseconds.
+struct FeedTimings {
+    struct Transfer {
+        CURLcode code = CURLE_OK;
+        long status = 0;
+        curl_off_t bytes = 0;
+        double dnsMs = 0;       // name lookup
+        double connectMs = 0;   // TCP handshake
+        double tlsMs = 0;       // TLS handshake
+        double ttfbMs = 0;      // start to first response byte
+        double totalMs = 0;
+    };
+
+    Transfer last;
+    double lastParseMs = 0;
+    size_t lastItems = 0;
+    RollingSamples dnsMs, connectMs, tlsMs, ttfbMs, totalMs, parseMs;
+
+    void recordTransfer(const FetchResult& result) {
+        last.code = result.code;
+        last.status = result.status;
+        last.bytes = result.downloadBytes;
+        last.dnsMs = result.nameLookupTime * 1000;
+        last.connectMs = max(0.0, result.connectTime - result.nameLookupTime) * 1000;
+        last.tlsMs = result.appConnectTime > 0 ? max(0.0, result.appConnectTime - result.connectTime) * 1000 : 0;
+        last.ttfbMs = result.startTransferTime * 1000;
+        last.totalMs = result.totalTime * 1000;
+
+        dnsMs.add(last.dnsMs);
+        connectMs.add(last.connectMs);
+        tlsMs.add(last.tlsMs);
+        ttfbMs.add(last.ttfbMs);
+        totalMs.add(last.totalMs);
+    }
+
+    void recordParse(double ms, size_t items) {
+        lastParseMs = ms;
+        lastItems = items;
+        parseMs.add(ms);
+    }
+
+    // {"last":{...},"p50":{...},"p90":{...},"p99":{...}}
+    string toJSON() const {
+        string json = "{\"last\":{\"status\":" + to_string(last.status) +
+            ",\"error\":\"" + (last.code == CURLE_OK ? "" : curl_easy_strerror(last.code)) +
+            "\",\"bytes\":" + to_string(last.bytes) +
+            ",\"dnsMs\":" + ms(last.dnsMs) +
+            ",\"connectMs\":" + ms(last.connectMs) +
+            ",\"tlsMs\":" + ms(last.tlsMs) +
+            ",\"ttfbMs\":" + ms(last.ttfbMs) +
+            ",\"totalMs\":" + ms(last.totalMs) +
+            ",\"parseMs\":" + ms(lastParseMs) +
+            ",\"items\":" + to_string(lastItems) + "}";
+        for (auto [name, q] : { pair<const char*, double>{ "p50", 0.5 }, { "p90", 0.9 }, { "p99", 0.99 } }) {
+            json += string(",\"") + name + "\":{\"dnsMs\":" + ms(dnsMs.percentile(q)) +
+                ",\"connectMs\":" + ms(connectMs.percentile(q)) +
+                ",\"tlsMs\":" + ms(tlsMs.percentile(q)) +
+                ",\"ttfbMs\":" + ms(ttfbMs.percentile(q)) +
+                ",\"totalMs\":" + ms(totalMs.percentile(q)) +
+                ",\"parseMs\":" + ms(parseMs.percentile(q)) + "}";
+        }
+        return json + "}";
+    }
+
+private:
+    static string ms(double value) {
+        char text[32];
+        snprintf(text, sizeof(text), "%.1f", value);
+        return text;
+    }
+};
+
+// One published generation of the feed. Segments are per-feed item lists
+// shared between generations, so publishing a feed only swaps its pointer.
+struct FeedSnapshot {
+    vector<shared_ptr<const FeedItems>> segments;
+    size_t itemCount = 0;
+    uint64_t generation = 0;
+    chrono::system_clock::time_point publishedAt{};
+
+    // The /news-feed body
+    string toJSON() const {
+        vector<string> jsonItems;
+        jsonItems.reserve(itemCount);
+        for (const auto& segment : segments) {
+            for (const auto& item : *segment) {
+                jsonItems.push_back(item->toJSON());
+            }
+        }
+
+        return JSON::array(jsonItems);
+    }
+};
+
 // RSS Aggregator
 class RSSAggregator {
 public:
-    RSSAggregator() {
+    explicit RSSAggregator(vector<Feed> feedList = defaultFeeds()) : feeds(move(feedList)) {
         curl_global_init(CURL_GLOBAL_DEFAULT);
+        workers = make_unique<WorkerPool>(max(2u, thread::hardware_concurrency()));
+        fetcher = make_unique<FetchScheduler>(*workers);
         initializeFeeds();
+        publishThread = thread([this]() { runPublisher(); });
     }
 
+    // Stops the scheduler first so nothing new is submitted, then drains the
+    // fetcher and workers (whose completions may still stage feeds), and the
+    // publisher last
     ~RSSAggregator() {
+        {
+            lock_guard<mutex> lock(scheduleMutex);
+            schedulerStopping = true;
+        }
+        scheduleCV.notify_all();
+        if (refreshThread.joinable()) refreshThread.join();
+
+        fetcher.reset();
+        workers.reset();
+        {
+            lock_guard<mutex> lock(stagingMutex);
+            stopping = true;
+        }
+        stagingCV.notify_all();
+        publishThread.join();
         curl_global_cleanup();
     }
 
+    // Refreshes each feed on its own learned cadence. The first round is
+    // staggered across the default interval so fetches never burst together.
     void startBackgroundRefresh() {
-        refreshThread = thread([this]() {
-            while (true) {
-                refresh();
-                this_thread::sleep_for(chrono::hours(1));
+        {
+            lock_guard<mutex> lock(scheduleMutex);
+            auto now = chrono::steady_clock::now();
+            for (size_t i = 0; i < feeds.size(); i++) {
+                auto offset = FeedSchedule::kDefaultInterval * (i + 1) / feeds.size();
+                dueQueue.push({ now + jitter(offset), i });
             }
-            });
-        refreshThread.detach();
+        }
+
+        refreshThread = thread([this]() { runScheduler(); });
     }
 
+    // Fetches every feed once. Each feed is published as soon as it is parsed,
+    // so a slow source only delays its own items.
     void refresh() {
+        Trace::Span span("refresh");
         cout << "🔄 Fetching RSS feeds..." << endl;
         auto start = chrono::steady_clock::now();
+        auto [hitsBefore, lookupsBefore] = bodyCacheTotals();
+        AllocationStats::Counts allocationsBefore = AllocationStats::background();
 
-        vector<thread> threads;
-        vector<vector<unordered_map<string, string>>> results(feeds.size());
+        size_t remaining = feeds.size();
+        mutex doneMutex;
+        condition_variable doneCV;
 
         for (size_t i = 0; i < feeds.size(); i++) {
-            threads.emplace_back([this, i, &results]() {
-                string xml = HTTPFetcher::fetch(feeds[i].url);
-                if (!xml.empty()) {
-                    results[i] = XMLParser::parseRSS(xml, feeds[i].source, feeds[i].category, feeds[i].country);
+            long timeoutMs;
+            {
+                lock_guard<mutex> lock(scheduleMutex);
+                timeoutMs = health[i].allowRequest(start) ? health[i].timeoutMs() : 0;
+            }
+            if (timeoutMs == 0) {
+                lock_guard<mutex> lock(doneMutex);
+                remaining--;
+                continue;
+            }
+
+            fetcher->submit(feeds[i].url, [&, i](FetchResult&& result) {
+                recordHealth(i, result);
+                if (result.ok() && !result.body.empty()) {
+                    auto items = parseFeed(i, result.body, result.contentType);
+                    {
+                        lock_guard<mutex> lock(scheduleMutex);
+                        schedules[i].observe(*items, chrono::steady_clock::now());
+                    }
+                    stageFeed(i, move(items));
                 }
-                });
+                lock_guard<mutex> lock(doneMutex);
+                if (--remaining == 0) doneCV.notify_one();
+                }, timeoutMs);
         }
 
-        for (auto& t : threads) {
-            if (t.joinable()) t.join();
+        {
+            unique_lock<mutex> lock(doneMutex);
+            doneCV.wait(lock, [&]() { return remaining == 0; });
         }
 
-        // Combine results
-        lock_guard<mutex> lock(dataMutex);
-        cachedItems.clear();
-        for (const auto& result : results) {
-            cachedItems.insert(cachedItems.end(), result.begin(), result.end());
-        }
+        publishStaged();
 
-        auto duration = chrono::duration_cast<chrono::seconds>(
-            chrono::steady_clock::now() - start
-        ).count();
+        auto elapsed = chrono::steady_clock::now() - start;
+        AllocationStats::Counts allocationsAfter = AllocationStats::background();
+        lastRefreshAllocations.store(allocationsAfter.allocations - allocationsBefore.allocations, memory_order_relaxed);
+        lastRefreshAllocatedBytes.store(allocationsAfter.bytes - allocationsBefore.bytes, memory_order_relaxed);
+        lastRefreshMicros.store(chrono::duration_cast<chrono::microseconds>(elapsed).count(), memory_order_relaxed);
+        refreshCount.fetch_add(1, memory_order_relaxed);
+        auto duration = chrono::duration_cast<chrono::seconds>(elapsed).count();
 
-        cout << "✅ Fetched " << cachedItems.size() << " items in " << duration << "s" << endl;
+        auto [hits, lookups] = bodyCacheTotals();
+        cout << "✅ Fetched " << getItemCount() << " items in " << duration << "s ("
+            << hits - hitsBefore << "/" << lookups - lookupsBefore << " bodies unchanged since last parse)" << endl;
     }
 
     string getJSON() {
-        lock_guard<mutex> lock(dataMutex);
+        return getSnapshot()->toJSON();
+    }
 
-        vector<string> jsonItems;
-        for (const auto& item : cachedItems) {
-            jsonItems.push_back(JSON::object(item));
-        }
+    size_t getItemCount() {
+        return getSnapshot()->itemCount;
+    }
 
-        return JSON::array(jsonItems);
+    shared_ptr<const FeedSnapshot> getSnapshot() {
+        lock_guard<TimedMutex> lock(dataMutex);
+        return snapshot;
     }
 
-    size_t getItemCount() {
-        lock_guard<mutex> lock(dataMutex);
-        return cachedItems.size();
+    string getFetchStatsJSON() {
+        return fetcher->statsJSON();
     }
 
-private:
-    void initializeFeeds() {
+    // Aggregator gauges and counters in Prometheus text format, for /metrics
+    string getMetricsText() {
+        shared_ptr<const FeedSnapshot> current = getSnapshot();
+        double age = chrono::duration<double>(chrono::system_clock::now() - current->publishedAt).count();
+        auto [hits, lookups] = bodyCacheTotals();
+
+        string text;
+        text += "# HELP realssa_refresh_duration_seconds Wall time of the last full refresh\n"
+            "# TYPE realssa_refresh_duration_seconds gauge\n"
+            "realssa_refresh_duration_seconds " + to_string(lastRefreshMicros.load(memory_order_relaxed) / 1e6) + "\n";
+        text += "# HELP realssa_refreshes_total Full refreshes completed\n"
+            "# TYPE realssa_refreshes_total counter\n"
+            "realssa_refreshes_total " + to_string(refreshCount.load(memory_order_relaxed)) + "\n";
+        text += "# HELP realssa_snapshot_generation Generation of the published snapshot\n"
+            "# TYPE realssa_snapshot_generation gauge\n"
+            "realssa_snapshot_generation " + to_string(current->generation) + "\n";
+        text += "# HELP realssa_snapshot_items Items in the published snapshot\n"
+            "# TYPE realssa_snapshot_items gauge\n"
+            "realssa_snapshot_items " + to_string(current->itemCount) + "\n";
+        text += "# HELP realssa_snapshot_age_seconds Time since the published snapshot was built\n"
+            "# TYPE realssa_snapshot_age_seconds gauge\n"
+            "realssa_snapshot_age_seconds " + to_string(age) + "\n";
+        text += "# HELP realssa_feeds Feeds configured\n"
+            "# TYPE realssa_feeds gauge\n"
+            "realssa_feeds " + to_string(feeds.size()) + "\n";
+        text += "# HELP realssa_body_cache_lookups_total Fetched bodies checked against the last parse\n"
+            "# TYPE realssa_body_cache_lookups_total counter\n"
+            "realssa_body_cache_lookups_total " + to_string(lookups) + "\n";
+        text += "# HELP realssa_body_cache_hits_total Fetched bodies unchanged since the last parse\n"
+            "# TYPE realssa_body_cache_hits_total counter\n"
+            "realssa_body_cache_hits_total " + to_string(hits) + "\n";
+        text += dataMutex.metricsText("data");
+        if (AllocationStats::kEnabled) {
+            AllocationStats::Counts background = AllocationStats::background();
+            text += "# HELP realssa_refresh_allocations Heap allocations during the last full refresh, outside HTTP handlers\n"
+                "# TYPE realssa_refresh_allocations gauge\n"
+                "realssa_refresh_allocations " + to_string(lastRefreshAllocations.load(memory_order_relaxed)) + "\n";
+            text += "# HELP realssa_refresh_allocated_bytes Bytes allocated during the last full refresh, outside HTTP handlers\n"
+                "# TYPE realssa_refresh_allocated_bytes gauge\n"
+                "realssa_refresh_allocated_bytes " + to_string(lastRefreshAllocatedBytes.load(memory_order_relaxed)) + "\n";
+            text += "# HELP realssa_background_allocations_total Heap allocations outside HTTP handlers\n"
+                "# TYPE realssa_background_allocations_total counter\n"
+                "realssa_background_allocations_total " + to_string(background.allocations) + "\n";
+            text += "# HELP realssa_background_allocated_bytes_total Bytes allocated outside HTTP handlers\n"
+                "# TYPE realssa_background_allocated_bytes_total counter\n"
+                "realssa_background_allocated_bytes_total " + to_string(background.bytes) + "\n";
+        }
+        return text;
+    }
+
+    string getFeedStatsJSON() {
+        lock_guard<mutex> lock(scheduleMutex);
+        auto now = chrono::steady_clock::now();
+
+        vector<string> jsonFeeds;
+        for (size_t i = 0; i < feeds.size(); i++) {
+            const FeedHealth& h = health[i];
+            const BodyCacheEntry& cache = bodyCache[i];
+            size_t lookups = cache.hits + cache.misses;
+            auto openFor = h.state == FeedHealth::State::Open && h.openUntil > now
+                ? chrono::duration_cast<chrono::seconds>(h.openUntil - now).count() : 0;
+            jsonFeeds.push_back("{\"source\":\"" + feeds[i].source + "\",\"url\":\"" + feeds[i].url +
+                "\",\"breaker\":\"" + h.stateName() +
+                "\",\"openForSec\":" + to_string(openFor) +
+                ",\"successes\":" + to_string(h.successes) +
+                ",\"failures\":" + to_string(h.failures) +
+                ",\"p50Ms\":" + to_string((long)(h.percentile(0.5) * 1000)) +
+                ",\"p99Ms\":" + to_string((long)(h.percentile(0.99) * 1000)) +
+                ",\"timeoutMs\":" + to_string(h.timeoutMs()) +
+                ",\"intervalSec\":" + to_string(schedules[i].interval.count()) +
+                ",\"bodyHits\":" + to_string(cache.hits) +
+                ",\"bodyMisses\":" + to_string(cache.misses) +
+                ",\"bodyHitRate\":" + to_string(lookups ? (double)cache.hits / lookups : 0.0) +
+                ",\"timings\":" + timings[i].toJSON() + "}");
+        }
+        return JSON::array(jsonFeeds);
+    }
+
+    // The publishers fetched by default. Tools build an aggregator over their
+    // own list (e.g. pointed at recorded fixtures) from this one.
+    static vector<Feed> defaultFeeds() {
+        vector<Feed> feeds;
         // GHANA (6 feeds)
         feeds.push_back({ "https://www.myjoyonline.com/feed/", "Joy Online", "General News", "Ghana" });
         feeds.push_back({ "https://www.graphic.com.gh/rss", "Daily Graphic", "General News", "Ghana" });
@@ -446,27 +3699,396 @@ private:
         feeds.push_back({ "https://www.skysports.com/rss/12040", "Sky Sports", "Sports", "Global" });
         feeds.push_back({ "https://www.goal.com/en/feeds/news", "Goal.com", "Sports", "Global" });
         feeds.push_back({ "https://www.theguardian.com/sport/rss", "Guardian Sports", "Sports", "Global" });
+        return feeds;
+    }
+
+private:
+    using DueEntry = pair<chrono::steady_clock::time_point, size_t>;
+
+    // Last parsed body per feed; publishers without validators often resend
+    // identical documents, which then skip parsing entirely. When the body did
+    // change, items already seen by guid are carried over from knownItems.
+    struct BodyCacheEntry {
+        uint64_t hash = 0;
+        shared_ptr<const FeedItems> items;
+        ItemIndex knownItems;
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    void runScheduler() {
+        Trace::nameThread("scheduler");
+        unique_lock<mutex> lock(scheduleMutex);
+        while (!schedulerStopping) {
+            if (dueQueue.empty()) {
+                scheduleCV.wait(lock);
+                continue;
+            }
+
+            auto [due, index] = dueQueue.top();
+            if (chrono::steady_clock::now() < due) {
+                // Woken early if a fetch completes and pushes an earlier due time
+                scheduleCV.wait_until(lock, due);
+                continue;
+            }
+            dueQueue.pop();
+
+            FeedHealth& feedHealth = health[index];
+            if (!feedHealth.allowRequest(chrono::steady_clock::now())) {
+                dueQueue.push({ feedHealth.openUntil, index });
+                continue;
+            }
+
+            fetcher->submit(feeds[index].url, [this, index](FetchResult&& result) {
+                onFeedFetched(index, move(result));
+                }, feedHealth.timeoutMs());
+        }
+    }
+
+    // Returns true if the breaker tripped open on this result
+    bool recordHealth(size_t index, const FetchResult& result) {
+        int64_t transferMicros = (int64_t)(result.totalTime * 1e6);
+        Trace::async("fetch", "feed", (int64_t)index, Trace::now() - transferMicros, transferMicros);
+
+        bool tripped = false;
+        {
+            lock_guard<mutex> lock(scheduleMutex);
+            timings[index].recordTransfer(result);
+            FeedHealth& feedHealth = health[index];
+            if (result.ok()) {
+                feedHealth.recordSuccess(result.totalTime);
+            }
+            else {
+                tripped = feedHealth.recordFailure(chrono::steady_clock::now());
+            }
+        }
+
+        if (tripped) {
+            cout << "⛔ " << feeds[index].source << ": failing (" << curl_easy_strerror(result.code)
+                << ", HTTP " << result.status << "), circuit open" << endl;
+        }
+        return tripped;
+    }
+
+    void onFeedFetched(size_t index, FetchResult&& result) {
+        const Feed& feed = feeds[index];
+        recordHealth(index, result);
+        string xml = result.ok() ? move(result.body) : string();
+        auto now = chrono::steady_clock::now();
+
+        shared_ptr<const FeedItems> items;
+        if (!xml.empty()) {
+            items = parseFeed(index, xml, result.contentType);
+        }
+
+        chrono::seconds interval;
+        size_t newItems = 0;
+        {
+            lock_guard<mutex> lock(scheduleMutex);
+            FeedSchedule& schedule = schedules[index];
+            if (items) newItems = schedule.observe(*items, now);
+            interval = schedule.interval;
+            // An open breaker is re-checked (and probed) when its backoff expires
+            if (health[index].state == FeedHealth::State::Open) {
+                dueQueue.push({ health[index].openUntil, index });
+            }
+            else {
+                dueQueue.push({ now + jitter(interval), index });
+            }
+        }
+        scheduleCV.notify_one();
+
+        // A failed fetch keeps serving the previous items until the next
+        // attempt. Any other change (edited, reordered or removed items, or
+        // items without links) is staged too; newItems only drives the cadence.
+        if (items) {
+            stageFeed(index, move(items));
+        }
+
+        cout << "🔁 " << feed.source << ": " << newItems << " new, next in "
+            << chrono::duration_cast<chrono::minutes>(interval).count() << "m" << endl;
+    }
+
+    // +/-10% so feeds sharing a cadence drift apart instead of re-synchronizing
+    chrono::steady_clock::duration jitter(chrono::steady_clock::duration d) {
+        uniform_real_distribution<double> dist(0.9, 1.1);
+        return chrono::duration_cast<chrono::steady_clock::duration>(d * dist(rng));
+    }
+
+    pair<size_t, size_t> bodyCacheTotals() {
+        lock_guard<mutex> lock(scheduleMutex);
+        size_t hits = 0, lookups = 0;
+        for (const auto& cache : bodyCache) {
+            hits += cache.hits;
+            lookups += cache.hits + cache.misses;
+        }
+        return { hits, lookups };
+    }
+
+    // The body hash is taken before any charset conversion, so an unchanged
+    // legacy-encoded feed is not converted again either
+    shared_ptr<const FeedItems> parseFeed(size_t index, const string& body, const string& contentType) {
+        uint64_t hash = ContentHash::hash64(body);
+        ItemIndex knownItems;
+        {
+            lock_guard<mutex> lock(scheduleMutex);
+            BodyCacheEntry& cache = bodyCache[index];
+            if (cache.items && cache.hash == hash) {
+                cache.hits++;
+                return cache.items;
+            }
+            cache.misses++;
+            knownItems = move(cache.knownItems);
+        }
+
+        Trace::Span span("parse", "feed", (int64_t)index);
+        auto start = chrono::steady_clock::now();
+        string converted;
+        string_view text = TextEncoding::toUTF8(body, contentType, converted);
+
+        const Feed& feed = feeds[index];
+        auto items = make_shared<const FeedItems>(
+            XMLParser::parseRSS(text, feed.source, feed.category, feed.country, &knownItems, workers.get()));
+        double parseMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        lock_guard<mutex> lock(scheduleMutex);
+        timings[index].recordParse(parseMs, items->size());
+        bodyCache[index].hash = hash;
+        bodyCache[index].items = items;
+        bodyCache[index].knownItems = move(knownItems);
+        return items;
+    }
+
+    // An unchanged body comes back from parseFeed as the segment already
+    // staged, which needs no new generation
+    void stageFeed(size_t index, shared_ptr<const FeedItems> items) {
+        Trace::Span span("merge", "feed", (int64_t)index);
+        {
+            lock_guard<mutex> lock(stagingMutex);
+            if (stagedSegments[index] == items) return;
+            stagedSegments[index] = move(items);
+            stagingDirty = true;
+        }
+        stagingCV.notify_one();
+    }
+
+    // Builds a new generation from the staged segments, if any changed, and
+    // swaps it in. Only the pointer swap happens under dataMutex. refresh()
+    // and the publisher can both get here, and whichever numbered later must
+    // win even if it reaches the swap first.
+    void publishStaged() {
+        Trace::Span span("publish");
+        auto next = make_shared<FeedSnapshot>();
+        {
+            lock_guard<mutex> lock(stagingMutex);
+            if (!stagingDirty) return;
+            stagingDirty = false;
+            next->segments = stagedSegments;
+            next->generation = ++generation;
+        }
+
+        for (const auto& segment : next->segments) next->itemCount += segment->size();
+        next->publishedAt = chrono::system_clock::now();
 
-        cout << "📡 Initialized " << feeds.size() << " RSS feeds" << endl;
+        lock_guard<TimedMutex> lock(dataMutex);
+        if (next->generation > snapshot->generation) snapshot = move(next);
+    }
+
+    // Completions that land within kPublishCoalesce of each other share one
+    // rebuild, so a burst of finished feeds doesn't publish a generation each
+    void runPublisher() {
+        Trace::nameThread("publisher");
+        unique_lock<mutex> lock(stagingMutex);
+        while (true) {
+            stagingCV.wait(lock, [this]() { return stagingDirty || stopping; });
+            if (stopping) return;
+
+            lock.unlock();
+            this_thread::sleep_for(kPublishCoalesce);
+            publishStaged();
+            lock.lock();
+        }
+    }
+
+    void initializeFeeds() {
+        auto empty = make_shared<const FeedItems>();
+        stagedSegments.assign(feeds.size(), empty);
+        auto initial = make_shared<FeedSnapshot>();
+        initial->segments = stagedSegments;
+        initial->publishedAt = chrono::system_clock::now();
+        snapshot = move(initial);
+        schedules.resize(feeds.size());
+        health.resize(feeds.size());
+        timings.resize(feeds.size());
+        bodyCache.resize(feeds.size());
+
+        cout << "📡 Initialized " << feeds.size() << " RSS feeds (parser scan: " << ByteScan::isa() << ")" << endl;
     }
 
     vector<Feed> feeds;
-    vector<unordered_map<string, string>> cachedItems;
-    mutex dataMutex;
+    static constexpr chrono::milliseconds kPublishCoalesce{ 250 };
+
+    shared_ptr<const FeedSnapshot> snapshot;
+    TimedMutex dataMutex;
+
+    vector<shared_ptr<const FeedItems>> stagedSegments;
+    bool stagingDirty = false;
+    bool stopping = false;
+    uint64_t generation = 0;
+    atomic<int64_t> lastRefreshMicros{ 0 };
+    atomic<uint64_t> refreshCount{ 0 };
+    atomic<uint64_t> lastRefreshAllocations{ 0 };
+    atomic<uint64_t> lastRefreshAllocatedBytes{ 0 };
+    mutex stagingMutex;
+    condition_variable stagingCV;
+    thread publishThread;
+
+    vector<FeedSchedule> schedules;
+    vector<FeedHealth> health;
+    vector<FeedTimings> timings;
+    vector<BodyCacheEntry> bodyCache;
+    priority_queue<DueEntry, vector<DueEntry>, greater<DueEntry>> dueQueue;
+    mt19937 rng{ random_device{}() };
+    mutex scheduleMutex;
+    condition_variable scheduleCV;
+    bool schedulerStopping = false;
     thread refreshThread;
+
+    unique_ptr<WorkerPool> workers;
+    unique_ptr<FetchScheduler> fetcher;
 };
 
-int main() {
-    RSSAggregator aggregator;
+// Per-route request counts, bytes sent, handler latency histograms and (with
+// AllocationStats on) heap allocations, recorded from the server's pre- and
+// post-routing hooks. Routes are fixed when the server is set up, and
+// recording is a few relaxed atomic adds, so handler threads never wait on
+// each other. Latency runs from routing to the response being ready to
+// write, i.e. excludes the socket write.
+class HTTPMetrics {
+public:
+    static constexpr array<double, 14> kBuckets = {
+        0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10,
+    };
+
+    explicit HTTPMetrics(vector<string> paths) : routes(paths.size() + 1) {
+        for (size_t i = 0; i < paths.size(); i++) routes[i].path = move(paths[i]);
+        routes.back().path = "other";
+    }
+
+    // Hooks the server's routing; the hooks share ownership of the metrics
+    static void attach(httplib::Server& svr, shared_ptr<HTTPMetrics> metrics) {
+        svr.set_pre_routing_handler([](const httplib::Request&, httplib::Response&) {
+            requestStart = chrono::steady_clock::now();
+            AllocationStats::markRequestThread();
+            requestAllocations = AllocationStats::thisThread();
+            return httplib::Server::HandlerResponse::Unhandled;
+            });
+        svr.set_post_routing_handler([metrics](const httplib::Request& req, httplib::Response& res) {
+            metrics->record(req, res);
+            });
+    }
 
-    // Initial fetch
-    aggregator.refresh();
+    string render() const {
+        string text;
+        text += "# HELP realssa_http_requests_total Requests handled, by route\n"
+            "# TYPE realssa_http_requests_total counter\n";
+        for (const auto& route : routes) {
+            text += "realssa_http_requests_total{route=\"" + route.path + "\"} " + to_string(route.count.load(memory_order_relaxed)) + "\n";
+        }
+        text += "# HELP realssa_http_response_bytes_total Response body bytes, by route\n"
+            "# TYPE realssa_http_response_bytes_total counter\n";
+        for (const auto& route : routes) {
+            text += "realssa_http_response_bytes_total{route=\"" + route.path + "\"} " + to_string(route.bytes.load(memory_order_relaxed)) + "\n";
+        }
+        text += "# HELP realssa_http_request_duration_seconds Handler latency, by route\n"
+            "# TYPE realssa_http_request_duration_seconds histogram\n";
+        for (const auto& route : routes) {
+            string label = "route=\"" + route.path + "\"";
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < kBuckets.size(); i++) {
+                cumulative += route.buckets[i].load(memory_order_relaxed);
+                char le[16];
+                snprintf(le, sizeof(le), "%g", kBuckets[i]);
+                text += "realssa_http_request_duration_seconds_bucket{" + label + ",le=\"" + le + "\"} " + to_string(cumulative) + "\n";
+            }
+            // Read last, so +Inf is never below the finite buckets read above
+            uint64_t count = route.observed.load(memory_order_relaxed);
+            text += "realssa_http_request_duration_seconds_bucket{" + label + ",le=\"+Inf\"} " + to_string(max(count, cumulative)) + "\n";
+            text += "realssa_http_request_duration_seconds_sum{" + label + "} " +
+                to_string(route.sumMicros.load(memory_order_relaxed) / 1e6) + "\n";
+            text += "realssa_http_request_duration_seconds_count{" + label + "} " + to_string(max(count, cumulative)) + "\n";
+        }
+        if (AllocationStats::kEnabled) {
+            text += "# HELP realssa_http_request_allocations_total Heap allocations made by handlers, by route\n"
+                "# TYPE realssa_http_request_allocations_total counter\n";
+            for (const auto& route : routes) {
+                text += "realssa_http_request_allocations_total{route=\"" + route.path + "\"} " + to_string(route.allocations.load(memory_order_relaxed)) + "\n";
+            }
+            text += "# HELP realssa_http_request_allocated_bytes_total Bytes allocated by handlers, by route\n"
+                "# TYPE realssa_http_request_allocated_bytes_total counter\n";
+            for (const auto& route : routes) {
+                text += "realssa_http_request_allocated_bytes_total{route=\"" + route.path + "\"} " + to_string(route.allocatedBytes.load(memory_order_relaxed)) + "\n";
+            }
+        }
+        return text;
+    }
 
-    // Start background refresh
-    aggregator.startBackgroundRefresh();
+private:
+    struct Route {
+        string path;
+        atomic<uint64_t> count{ 0 };
+        atomic<uint64_t> bytes{ 0 };
+        array<atomic<uint64_t>, kBuckets.size()> buckets{};   // per bucket, not cumulative
+        atomic<uint64_t> observed{ 0 };
+        atomic<uint64_t> sumMicros{ 0 };
+        atomic<uint64_t> allocations{ 0 };
+        atomic<uint64_t> allocatedBytes{ 0 };
+    };
 
-    // HTTP server
-    httplib::Server svr;
+    // Set by the pre-routing hook. httplib runs a request's hooks and handler
+    // on one thread, so the post-routing hook finds its own start here.
+    static thread_local chrono::steady_clock::time_point requestStart;
+    static thread_local AllocationStats::Counts requestAllocations;
+
+    void record(const httplib::Request& req, const httplib::Response& res) {
+        Route& route = routeFor(req.matched_route);
+        route.count.fetch_add(1, memory_order_relaxed);
+        route.bytes.fetch_add(res.body.size(), memory_order_relaxed);
+
+        // Requests rejected before routing (malformed, too long) never started
+        if (requestStart == chrono::steady_clock::time_point{}) return;
+        auto micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - requestStart).count();
+        requestStart = {};
+
+        double seconds = micros / 1e6;
+        size_t bucket = lower_bound(kBuckets.begin(), kBuckets.end(), seconds) - kBuckets.begin();
+        if (bucket < kBuckets.size()) route.buckets[bucket].fetch_add(1, memory_order_relaxed);
+        route.observed.fetch_add(1, memory_order_relaxed);
+        route.sumMicros.fetch_add((uint64_t)micros, memory_order_relaxed);
+
+        AllocationStats::Counts allocated = AllocationStats::thisThread();
+        route.allocations.fetch_add(allocated.allocations - requestAllocations.allocations, memory_order_relaxed);
+        route.allocatedBytes.fetch_add(allocated.bytes - requestAllocations.bytes, memory_order_relaxed);
+    }
+
+    Route& routeFor(const string& pattern) {
+        for (size_t i = 0; i + 1 < routes.size(); i++) {
+            if (routes[i].path == pattern) return routes[i];
+        }
+        return routes.back();
+    }
+
+    vector<Route> routes;
+};
+
+thread_local chrono::steady_clock::time_point HTTPMetrics::requestStart{};
+thread_local AllocationStats::Counts HTTPMetrics::requestAllocations{};
+
+// The API's endpoints, shared by main and the tools that serve it locally
+void registerRoutes(httplib::Server& svr, RSSAggregator& aggregator) {
+    auto metrics = make_shared<HTTPMetrics>(vector<string>{ "/", "/news-feed", "/health", "/notifications",
+        "/debug/fetch", "/debug/feeds", "/debug/trace", "/debug/profile", "/metrics" });
+    HTTPMetrics::attach(svr, metrics);
 
     svr.Get("/", [](const httplib::Request&, httplib::Response& res) {
         res.set_content(R"(
@@ -526,6 +4148,46 @@ int main() {
         res.set_content(json, "application/json");
         });
 
+    svr.Get("/debug/fetch", [&aggregator](const httplib::Request&, httplib::Response& res) {
+        res.set_content(aggregator.getFetchStatsJSON(), "application/json");
+        });
+
+    svr.Get("/debug/feeds", [&aggregator](const httplib::Request&, httplib::Response& res) {
+        res.set_content(aggregator.getFeedStatsJSON(), "application/json");
+        });
+
+    // Chrome Trace Event JSON of the last ?refreshes=N (default 1) refreshes
+    // and whatever overlapped them; open in ui.perfetto.dev
+    svr.Get("/debug/trace", [](const httplib::Request& req, httplib::Response& res) {
+        size_t refreshes = req.has_param("refreshes") ? strtoul(req.get_param_value("refreshes").c_str(), nullptr, 10) : 1;
+        res.set_content(Trace::toJSON(refreshes), "application/json");
+        });
+
+    // Folded CPU stacks sampled over ?seconds=N (default 10, at most 60) at
+    // ?hz=N (default 99); pipe into flamegraph.pl. Opt-in with ENABLE_PROFILER.
+    if (getenv("ENABLE_PROFILER")) {
+        svr.Get("/debug/profile", [](const httplib::Request& req, httplib::Response& res) {
+            int seconds = req.has_param("seconds") ? atoi(req.get_param_value("seconds").c_str()) : 10;
+            int hz = req.has_param("hz") ? atoi(req.get_param_value("hz").c_str()) : Profiler::kDefaultHz;
+            seconds = clamp(seconds, 1, 60);
+            hz = clamp(hz, 1, 1000);
+
+            Profiler::Result result;
+            if (!Profiler::profile(seconds, hz, result)) {
+                res.status = result.busy ? 409 : 500;
+                res.set_content(result.error + "\n", "text/plain");
+                return;
+            }
+            res.set_header("X-Profile-Samples", to_string(result.samples));
+            res.set_header("X-Profile-Dropped", to_string(result.dropped));
+            res.set_content(result.folded, "text/plain");
+            });
+    }
+
+    svr.Get("/metrics", [&aggregator, metrics](const httplib::Request&, httplib::Response& res) {
+        res.set_content(metrics->render() + aggregator.getMetricsText(), "text/plain; version=0.0.4");
+        });
+
     svr.Get("/notifications", [&aggregator](const httplib::Request&, httplib::Response& res) {
         // Return latest items for notifications (items from last 2 hours)
         string allItems = aggregator.getJSON();
@@ -535,6 +4197,24 @@ int main() {
         res.set_header("Access-Control-Allow-Origin", "*");
         res.set_content(json, "application/json");
         });
+}
+
+// bench/ and tools/ include this file for its classes and supply their own main
+#ifndef REALSSA_NO_MAIN
+int main() {
+    RSSAggregator aggregator;
+
+    // Initial fetch runs while the server is already up; feeds are served as
+    // they arrive, then the background scheduler takes over
+    thread([&aggregator]() {
+        Trace::nameThread("initial refresh");
+        aggregator.refresh();
+        aggregator.startBackgroundRefresh();
+        }).detach();
+
+    // HTTP server
+    httplib::Server svr;
+    registerRoutes(svr, aggregator);
 
     const char* port_str = getenv("PORT");
     int port = port_str ? atoi(port_str) : 3000;
@@ -543,4 +4223,5 @@ int main() {
     svr.listen("0.0.0.0", port);
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
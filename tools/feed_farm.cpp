@@ -0,0 +1,324 @@
+// feed_farm.cpp
+// Serves N synthetic RSS feeds from a local HTTP server and times a cold
+// RSSAggregator::refresh() against them, to see how refresh scales with the
+// number of feeds.
+// Build: g++ -std=c++17 -O2 -pthread tools/feed_farm.cpp -lcurl -lssl -lcrypto -lz -o feed_farm
+// Run:
+//   ./feed_farm serve <feeds> [options]          just the farm, until killed
+//   ./feed_farm run <feeds> [options]            one refresh, one CSV row
+//   ./feed_farm sweep <n1,n2,...> [options]      one run per count, each in its own process
+// Options:
+//   --items=20            items per feed
+//   --item-bytes=400      description length per item
+//   --latency-ms=100      median response latency (log-normal)
+//   --latency-sigma=0.5   log-normal shape; 0 makes every response take the median
+//   --error-rate=0        fraction of requests answered with a 503
+//   --hosts=0             distinct hosts the feeds are spread over, 0 for one per feed
+//   --no-gzip             ignore Accept-Encoding and always send identity bodies
+//   --port=0              farm port, 0 for any free one
+//
+// Rows are feeds,hosts,items,wall_ms,cpu_s,peak_rss_mb, measured in the
+// process that runs the aggregator. The farm runs in a forked child, so it
+// counts toward neither CPU nor RSS. Redirect sweep output to a .csv to chart it.
+
+#define REALSSA_NO_MAIN
+// httplib's default backlog of 5 drops the SYNs of a refresh's first burst
+// of connections, which then retry a second later
+#define CPPHTTPLIB_LISTEN_BACKLOG 1024
+#include "../realssa_news_linux.cpp"
+
+#include <iomanip>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace {
+
+struct FarmOptions {
+    size_t feeds = 0;
+    size_t items = 20;
+    size_t itemBytes = 400;
+    double latencyMs = 100;
+    double latencySigma = 0.5;
+    double errorRate = 0;
+    size_t hosts = 0;
+    bool gzip = true;
+    int port = 0;
+
+    // "--name=value" flags, as listed in the header comment. Returns false on
+    // anything it does not recognize.
+    bool parse(int argc, char** argv, int first) {
+        for (int i = first; i < argc; i++) {
+            string arg = argv[i];
+            size_t eq = arg.find('=');
+            string name = arg.substr(0, eq);
+            const char* value = eq == string::npos ? "" : argv[i] + eq + 1;
+            if (name == "--items") items = strtoul(value, nullptr, 10);
+            else if (name == "--item-bytes") itemBytes = strtoul(value, nullptr, 10);
+            else if (name == "--latency-ms") latencyMs = atof(value);
+            else if (name == "--latency-sigma") latencySigma = atof(value);
+            else if (name == "--error-rate") errorRate = atof(value);
+            else if (name == "--hosts") hosts = strtoul(value, nullptr, 10);
+            else if (name == "--no-gzip") gzip = false;
+            else if (name == "--port") port = atoi(value);
+            else return false;
+        }
+        return true;
+    }
+
+    size_t hostCount() const {
+        return hosts == 0 ? feeds : min(hosts, feeds);
+    }
+};
+
+// Deterministic RSS 2.0 documents: feed n always renders the same bytes, so
+// runs compare like for like
+class SyntheticFeed {
+public:
+    static string render(size_t feed, const FarmOptions& options) {
+        string xml;
+        xml.reserve(256 + options.items * (options.itemBytes + 400));
+        xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<rss version=\"2.0\" xmlns:media=\"http://search.yahoo.com/mrss/\">\n<channel>\n"
+            "<title>Synthetic feed " + to_string(feed) + "</title>\n"
+            "<link>https://feed" + to_string(feed) + ".example.com/</link>\n";
+
+        mt19937 rng((uint32_t)feed);
+        time_t newest = 1767225600 - (time_t)(feed % 3600);   // 2026-01-01, staggered per feed
+        for (size_t i = 0; i < options.items; i++) {
+            string link = "https://feed" + to_string(feed) + ".example.com/story/" + to_string(i);
+            xml += "<item>\n<title>Feed " + to_string(feed) + " story " + to_string(i) + ": " + words(rng, 8) + "</title>\n"
+                "<link>" + link + "</link>\n"
+                "<guid isPermaLink=\"true\">" + link + "</guid>\n"
+                "<pubDate>" + rfc822(newest - (time_t)i * 900) + "</pubDate>\n"
+                "<description><![CDATA[<p>" + text(rng, options.itemBytes) + "</p>]]></description>\n"
+                "<media:thumbnail url=\"https://img.example.com/" + to_string(feed) + "/" + to_string(i) + ".jpg\" width=\"240\"/>\n"
+                "</item>\n";
+        }
+        xml += "</channel>\n</rss>\n";
+        return xml;
+    }
+
+private:
+    static string words(mt19937& rng, size_t count) {
+        static constexpr const char* kWords[] = {
+            "market", "election", "minister", "league", "storm", "budget", "court", "launch",
+            "report", "talks", "record", "health", "energy", "border", "study", "festival",
+        };
+        string out;
+        for (size_t i = 0; i < count; i++) {
+            if (i) out += ' ';
+            out += kWords[rng() % size(kWords)];
+        }
+        return out;
+    }
+
+    static string text(mt19937& rng, size_t bytes) {
+        string out;
+        while (out.size() < bytes) {
+            out += words(rng, 12);
+            out += ". ";
+        }
+        out.resize(bytes);
+        return out;
+    }
+
+    static string rfc822(time_t when) {
+        char buf[40];
+        tm utc;
+        gmtime_r(&when, &utc);
+        strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S +0000", &utc);
+        return buf;
+    }
+};
+
+string gzipped(const string& data) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    string out(deflateBound(&stream, data.size()), '\0');
+    stream.next_in = (Bytef*)data.data();
+    stream.avail_in = (uInt)data.size();
+    stream.next_out = (Bytef*)out.data();
+    stream.avail_out = (uInt)out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+// Feed n is http://<address of host n % hosts>:<port>/feed/n. Hosts are
+// 127.x.y.z loopback addresses (hence listening on all interfaces), so the
+// fetch scheduler's per-host limits apply as they would across publishers.
+class FeedFarm {
+public:
+    // curl keeps up to 2 * kMaxTotal idle connections open, each holding a
+    // server thread in keep-alive, on top of the transfers in flight
+    static constexpr size_t kThreads = FetchScheduler::kMaxTotal * 4;
+
+    static string urlOf(size_t feed, const FarmOptions& options, int port) {
+        size_t n = feed % options.hostCount() + 1;
+        return "http://127." + to_string((n >> 16) & 255) + "." + to_string((n >> 8) & 255) + "." + to_string(n & 255) +
+            ":" + to_string(port) + "/feed/" + to_string(feed);
+    }
+
+    explicit FeedFarm(const FarmOptions& options) : options(options) {
+        server.new_task_queue = []() { return new httplib::ThreadPool(kThreads); };
+        server.Get(R"(/feed/(\d+))", [this](const httplib::Request& req, httplib::Response& res) {
+            serve(req, res);
+            });
+    }
+
+    int bind() {
+        return options.port ? (server.bind_to_port("0.0.0.0", options.port) ? options.port : -1)
+            : server.bind_to_any_port("0.0.0.0");
+    }
+
+    void listen() {
+        server.listen_after_bind();
+    }
+
+private:
+    void serve(const httplib::Request& req, httplib::Response& res) {
+        size_t feed = strtoul(req.matches[1].str().c_str(), nullptr, 10);
+        if (feed >= options.feeds) {
+            res.status = 404;
+            return;
+        }
+
+        double latency;
+        bool fail;
+        {
+            lock_guard<mutex> lock(rngMutex);
+            latency = options.latencyMs * exp(options.latencySigma * normal(rng));
+            fail = failure(rng) < options.errorRate;
+        }
+        this_thread::sleep_for(chrono::duration<double, milli>(latency));
+
+        if (fail) {
+            res.status = 503;
+            return;
+        }
+
+        string xml = SyntheticFeed::render(feed, options);
+        if (options.gzip && req.get_header_value("Accept-Encoding").find("gzip") != string::npos) {
+            res.set_header("Content-Encoding", "gzip");
+            res.set_content(gzipped(xml), "application/rss+xml; charset=utf-8");
+        }
+        else {
+            res.set_content(xml, "application/rss+xml; charset=utf-8");
+        }
+    }
+
+    FarmOptions options;
+    httplib::Server server;
+    mutex rngMutex;
+    mt19937 rng{ 42 };
+    normal_distribution<double> normal{ 0.0, 1.0 };
+    uniform_real_distribution<double> failure{ 0.0, 1.0 };
+};
+
+int serve(const FarmOptions& options) {
+    FeedFarm farm(options);
+    int port = farm.bind();
+    if (port < 0) {
+        cerr << "Could not bind port " << options.port << endl;
+        return 1;
+    }
+    cout << "🚜 Serving " << options.feeds << " feeds on " << options.hostCount() << " hosts, e.g. "
+        << FeedFarm::urlOf(0, options, port) << endl;
+    farm.listen();
+    return 0;
+}
+
+// The farm is forked off before any thread exists, then the aggregator does
+// one cold refresh over every feed. CPU and peak RSS are this process's own.
+int run(const FarmOptions& options) {
+    FeedFarm farm(options);
+    int port = farm.bind();
+    if (port < 0) {
+        cerr << "Could not bind port " << options.port << endl;
+        return 1;
+    }
+
+    pid_t child = fork();
+    if (child == 0) {
+        farm.listen();
+        _exit(0);
+    }
+
+    vector<Feed> feeds;
+    feeds.reserve(options.feeds);
+    for (size_t i = 0; i < options.feeds; i++) {
+        feeds.push_back({ FeedFarm::urlOf(i, options, port), "Farm " + to_string(i), "General News", "Global" });
+    }
+
+    double wallMs;
+    size_t items;
+    {
+        RSSAggregator aggregator(move(feeds));
+        auto start = chrono::steady_clock::now();
+        aggregator.refresh();
+        wallMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        items = aggregator.getItemCount();
+    }
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    double cpu = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+
+    kill(child, SIGTERM);
+    waitpid(child, nullptr, 0);
+
+    cout << options.feeds << "," << options.hostCount() << "," << items << "," << (long)wallMs << ","
+        << fixed << setprecision(2) << cpu << "," << usage.ru_maxrss / 1024.0 << endl;
+    return 0;
+}
+
+// Each count runs as a separate `run`, so peak RSS starts from zero every
+// time. CSV rows go to stdout, everything else the runs print to stderr.
+int sweep(const string& counts, int argc, char** argv) {
+    char self[4096];
+    ssize_t length = readlink("/proc/self/exe", self, sizeof(self) - 1);
+    if (length <= 0) return 1;
+    self[length] = '\0';
+
+    string passthrough;
+    for (int i = 3; i < argc; i++) passthrough += string(" '") + argv[i] + "'";
+
+    cout << "feeds,hosts,items,wall_ms,cpu_s,peak_rss_mb" << endl;
+    stringstream list(counts);
+    string count;
+    while (getline(list, count, ',')) {
+        FILE* pipe = popen(("'" + string(self) + "' run " + count + passthrough).c_str(), "r");
+        if (!pipe) return 1;
+        char line[4096];
+        while (fgets(line, sizeof(line), pipe)) {
+            if (isdigit((unsigned char)line[0])) cout << line << flush;
+            else cerr << line;
+        }
+        pclose(pipe);
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    string mode = argc > 1 ? argv[1] : "";
+    FarmOptions options;
+    if (argc < 3 || (mode != "serve" && mode != "run" && mode != "sweep") || !options.parse(argc, argv, 3)) {
+        cerr << "Usage: " << argv[0] << " serve|run <feeds> | sweep <n1,n2,...>  [options, see feed_farm.cpp]" << endl;
+        return 2;
+    }
+
+    if (mode == "sweep") return sweep(argv[2], argc, argv);
+
+    options.feeds = strtoul(argv[2], nullptr, 10);
+    if (options.feeds == 0) {
+        cerr << "Need at least one feed" << endl;
+        return 2;
+    }
+    return mode == "serve" ? serve(options) : run(options);
+}
@@ -0,0 +1,276 @@
+// feed_replay.cpp
+// Records every default feed's response (status, headers, body, timings) to a
+// fixture directory, and replays it from a local stand-in server so
+// RSSAggregator::refresh() can be benchmarked end to end without network.
+// Build: g++ -std=c++17 -O2 -pthread tools/feed_replay.cpp -lcurl -lssl -lcrypto -o feed_replay
+// Run from the repository root:
+//   ./feed_replay record <dir>             fetch every feed once, as the service would
+//   ./feed_replay replay <dir> [rounds]    cold refresh() against the fixtures, timed per round
+
+#define REALSSA_NO_MAIN
+// httplib's default backlog of 5 drops the SYNs of a refresh's first burst
+// of connections, which then retry a second later
+#define CPPHTTPLIB_LISTEN_BACKLOG 1024
+#include "../realssa_news_linux.cpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+// One recorded response, stored as <id>.meta (url, outcome, timings and
+// headers, one per line) next to <id>.body (the body bytes as received)
+struct Fixture {
+    string id;
+    string url;
+    long code = 0;                 // CURLcode of the transfer
+    long status = 0;
+    double startTransferTime = 0;  // seconds
+    double totalTime = 0;          // seconds
+    string contentType;
+    vector<pair<string, string>> headers;
+    string body;
+};
+
+class FixtureStore {
+public:
+    static void save(const filesystem::path& dir, const Fixture& fixture) {
+        ofstream meta(dir / (fixture.id + ".meta"));
+        meta << "url " << fixture.url << "\n"
+            << "code " << fixture.code << "\n"
+            << "status " << fixture.status << "\n"
+            << fixed << setprecision(6)
+            << "start_transfer " << fixture.startTransferTime << "\n"
+            << "total " << fixture.totalTime << "\n"
+            << "content_type " << fixture.contentType << "\n";
+        for (const auto& [name, value] : fixture.headers) meta << "header " << name << ": " << value << "\n";
+
+        ofstream body(dir / (fixture.id + ".body"), ios::binary);
+        body.write(fixture.body.data(), fixture.body.size());
+    }
+
+    static vector<Fixture> load(const filesystem::path& dir) {
+        vector<Fixture> fixtures;
+        for (const auto& entry : filesystem::directory_iterator(dir)) {
+            if (entry.path().extension() != ".meta") continue;
+
+            Fixture fixture;
+            fixture.id = entry.path().stem().string();
+            ifstream meta(entry.path());
+            string line;
+            while (getline(meta, line)) {
+                size_t space = line.find(' ');
+                string key = line.substr(0, space);
+                string value = space == string::npos ? "" : line.substr(space + 1);
+                if (key == "url") fixture.url = value;
+                else if (key == "code") fixture.code = atol(value.c_str());
+                else if (key == "status") fixture.status = atol(value.c_str());
+                else if (key == "start_transfer") fixture.startTransferTime = atof(value.c_str());
+                else if (key == "total") fixture.totalTime = atof(value.c_str());
+                else if (key == "content_type") fixture.contentType = value;
+                else if (key == "header") {
+                    size_t colon = value.find(": ");
+                    if (colon != string::npos) fixture.headers.push_back({ value.substr(0, colon), value.substr(colon + 2) });
+                }
+            }
+
+            ifstream body(dir / (fixture.id + ".body"), ios::binary);
+            stringstream content;
+            content << body.rdbuf();
+            fixture.body = content.str();
+            fixtures.push_back(move(fixture));
+        }
+        sort(fixtures.begin(), fixtures.end(), [](const Fixture& a, const Fixture& b) { return a.id < b.id; });
+        return fixtures;
+    }
+};
+
+// Fetches every default feed through the same scheduler and curl settings as
+// the service, all submitted at once like the initial refresh
+int record(const filesystem::path& dir) {
+    filesystem::create_directories(dir);
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    vector<Feed> feeds = RSSAggregator::defaultFeeds();
+    size_t remaining = feeds.size();
+    size_t failed = 0;
+    mutex doneMutex;
+    condition_variable doneCV;
+    {
+        WorkerPool pool(2);
+        FetchScheduler fetcher(pool, true);
+        for (size_t i = 0; i < feeds.size(); i++) {
+            fetcher.submit(feeds[i].url, [&, i](FetchResult&& result) {
+                char id[8];
+                snprintf(id, sizeof(id), "%03zu", i);
+
+                Fixture fixture;
+                fixture.id = id;
+                fixture.url = feeds[i].url;
+                fixture.code = result.code;
+                fixture.status = result.status;
+                fixture.startTransferTime = result.startTransferTime;
+                fixture.totalTime = result.totalTime;
+                fixture.contentType = result.contentType;
+                fixture.headers = move(result.headers);
+                fixture.body = move(result.body);
+                FixtureStore::save(dir, fixture);
+
+                lock_guard<mutex> lock(doneMutex);
+                if (!result.ok()) failed++;
+                cout << (result.ok() ? "📼 " : "⚠️ ") << feeds[i].source << ": HTTP " << result.status
+                    << ", " << fixture.body.size() << " bytes in " << (long)(result.totalTime * 1000) << "ms" << endl;
+                if (--remaining == 0) doneCV.notify_one();
+                });
+        }
+
+        unique_lock<mutex> lock(doneMutex);
+        doneCV.wait(lock, [&]() { return remaining == 0; });
+    }
+
+    curl_global_cleanup();
+    cout << "✅ Recorded " << feeds.size() << " feeds (" << failed << " failed) to " << dir.string() << endl;
+    return 0;
+}
+
+// Serves fixtures at http://<loopback address>:<port>/<id>. Each publisher
+// host gets its own 127.x.y.z address, so the fetch scheduler's per-host
+// limits and connection reuse see the same host layout as live. That is why
+// the server listens on all interfaces rather than just 127.0.0.1.
+//
+// A response waits out the recorded time to first byte before its headers
+// go out, then the body is paced to finish at the recorded total time.
+// Transfers that failed outright (timeouts, DNS, TLS) come back as a 504
+// after their recorded duration.
+class ReplayServer {
+public:
+    static constexpr size_t kChunkSize = 16 * 1024;
+    // curl keeps up to 2 * kMaxTotal idle connections open, each holding a
+    // server thread in keep-alive, on top of the transfers in flight
+    static constexpr size_t kThreads = FetchScheduler::kMaxTotal * 4;
+
+    explicit ReplayServer(const vector<Fixture>& fixtures) {
+        server.new_task_queue = []() { return new httplib::ThreadPool(kThreads); };
+        for (const Fixture& fixture : fixtures) {
+            server.Get("/" + fixture.id, [&fixture](const httplib::Request&, httplib::Response& res) {
+                serve(fixture, res);
+                });
+        }
+
+        port = server.bind_to_any_port("0.0.0.0");
+        listener = thread([this]() { server.listen_after_bind(); });
+        server.wait_until_ready();
+    }
+
+    ~ReplayServer() {
+        server.stop();
+        listener.join();
+    }
+
+    // The fixture's URL as served here, on the loopback address of its host
+    string urlFor(const Fixture& fixture) {
+        string host = HTTPFetcher::hostOf(fixture.url);
+        auto [it, added] = loopbackHosts.try_emplace(host, loopbackHosts.size() + 1);
+        size_t n = it->second;
+        return "http://127.0." + to_string(n / 256) + "." + to_string(n % 256) + ":" + to_string(port) + "/" + fixture.id;
+    }
+
+private:
+    static void serve(const Fixture& fixture, httplib::Response& res) {
+        auto start = chrono::steady_clock::now();
+        this_thread::sleep_for(chrono::duration<double>(fixture.startTransferTime));
+
+        if (fixture.code != CURLE_OK) {
+            this_thread::sleep_for(chrono::duration<double>(max(0.0, fixture.totalTime - fixture.startTransferTime)));
+            res.status = 504;
+            return;
+        }
+
+        res.status = (int)fixture.status;
+        for (const auto& [name, value] : fixture.headers) {
+            if (!isReplayable(name)) continue;
+            res.set_header(name, value);
+        }
+
+        auto bodyStart = start + chrono::duration_cast<chrono::steady_clock::duration>(
+            chrono::duration<double>(fixture.startTransferTime));
+        double bodyTime = max(0.0, fixture.totalTime - fixture.startTransferTime);
+        res.set_content_provider(fixture.body.size(), fixture.contentType,
+            [&fixture, bodyStart, bodyTime](size_t offset, size_t length, httplib::DataSink& sink) {
+                size_t n = min(length, kChunkSize);
+                double share = (double)(offset + n) / fixture.body.size();
+                this_thread::sleep_until(bodyStart + chrono::duration_cast<chrono::steady_clock::duration>(
+                    chrono::duration<double>(bodyTime * share)));
+                return sink.write(fixture.body.data() + offset, n);
+            });
+    }
+
+    // Framing and encoding headers describe the original connection, not
+    // this one; the body was stored decoded
+    static bool isReplayable(const string& name) {
+        for (const char* skipped : { "content-length", "transfer-encoding", "content-encoding", "connection",
+            "keep-alive", "content-type" }) {
+            if (strcasecmp(name.c_str(), skipped) == 0) return false;
+        }
+        return true;
+    }
+
+    httplib::Server server;
+    thread listener;
+    int port = 0;
+    unordered_map<string, size_t> loopbackHosts;
+};
+
+// Every default feed that has a fixture, pointed at the stand-in server. Each
+// round runs refresh() on a new aggregator, so every round is a cold start:
+// no connections, body cache or learned timeouts carried over.
+int replay(const filesystem::path& dir, int rounds) {
+    vector<Fixture> fixtures = FixtureStore::load(dir);
+    if (fixtures.empty()) {
+        cerr << "No fixtures in " << dir.string() << endl;
+        return 1;
+    }
+
+    ReplayServer server(fixtures);
+
+    unordered_map<string, const Fixture*> byURL;
+    for (const Fixture& fixture : fixtures) byURL[fixture.url] = &fixture;
+
+    vector<Feed> feeds;
+    for (Feed feed : RSSAggregator::defaultFeeds()) {
+        auto it = byURL.find(feed.url);
+        if (it == byURL.end()) continue;
+        feed.url = server.urlFor(*it->second);
+        feeds.push_back(move(feed));
+    }
+    cout << "📼 Replaying " << feeds.size() << " of " << fixtures.size() << " fixtures" << endl;
+
+    vector<double> times;
+    for (int round = 0; round < rounds; round++) {
+        RSSAggregator aggregator(feeds);
+        auto start = chrono::steady_clock::now();
+        aggregator.refresh();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        times.push_back(ms);
+        cout << "⏱️ Round " << round + 1 << ": " << (long)ms << "ms, " << aggregator.getItemCount() << " items" << endl;
+    }
+
+    sort(times.begin(), times.end());
+    cout << "✅ refresh() over " << rounds << " rounds: min " << (long)times.front() << "ms, median "
+        << (long)times[times.size() / 2] << "ms, max " << (long)times.back() << "ms" << endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    string mode = argc > 1 ? argv[1] : "";
+    if (argc < 3 || (mode != "record" && mode != "replay")) {
+        cerr << "Usage: " << argv[0] << " record <dir> | replay <dir> [rounds]" << endl;
+        return 2;
+    }
+
+    if (mode == "record") return record(argv[2]);
+    return replay(argv[2], argc > 3 ? max(1, atoi(argv[3])) : 3);
+}
@@ -0,0 +1,341 @@
+// load_gen.cpp
+// HTTP load generator for the API endpoints: open-loop (fixed arrival rate)
+// or closed-loop traffic over a pool of keep-alive connections, with a
+// weighted endpoint mix, reporting throughput and p50/p99/p99.9 latency.
+// Build: g++ -std=c++17 -O2 -pthread tools/load_gen.cpp -lcurl -lssl -lcrypto -o load_gen
+// Run from the repository root:
+//   ./load_gen [options] http://localhost:3000   against a running server
+//   ./load_gen [options] --local                 against an in-process server fed from bench/corpus
+// Options:
+//   --rate=0                requests per second across all connections; 0 runs closed-loop
+//   --connections=16        keep-alive connections, one sending thread each
+//   --duration=10           seconds of measured load, after one warm-up request per connection
+//   --mix=/news-feed:6,/health:3,/notifications:1   endpoints and their weights
+//   --feeds=87              feeds behind the --local server, cycling over the corpus files
+//   --corpus=bench/corpus   where --local reads feed bodies from
+//
+// Open-loop latency is measured from when a request was due, not from when a
+// connection got around to sending it, so queueing behind a slow response
+// counts (no coordinated omission). With --local the generator, the server
+// and its fixture feeds share the machine; compare runs, not absolute numbers.
+
+#define REALSSA_NO_MAIN
+// httplib's default backlog of 5 drops the SYNs of the connections opened
+// at start, which then retry a second later
+#define CPPHTTPLIB_LISTEN_BACKLOG 1024
+#include "../realssa_news_linux.cpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+// Log-linear histogram in the manner of HdrHistogram: microsecond values are
+// grouped by power of two, each split into kSubBuckets / 2 linear steps, so a
+// reported percentile is within 1% of the recorded value. Fixed size, so each
+// sending thread keeps its own and they are merged at the end.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 8;
+    static constexpr uint64_t kSubBuckets = 1 << kSubBucketBits;
+    static constexpr size_t kSize = kSubBuckets + (64 - kSubBucketBits) * (kSubBuckets / 2);
+
+    void record(uint64_t micros) {
+        counts[indexOf(micros)]++;
+        total++;
+        maximum = max(maximum, micros);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < kSize; i++) counts[i] += other.counts[i];
+        total += other.total;
+        maximum = max(maximum, other.maximum);
+    }
+
+    // Highest value equivalent to the q-th quantile's bucket, in microseconds
+    uint64_t percentile(double q) const {
+        if (total == 0) return 0;
+        uint64_t rank = max<uint64_t>(1, (uint64_t)ceil(q * total));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kSize; i++) {
+            seen += counts[i];
+            if (seen >= rank) return min(highestIn(i), maximum);
+        }
+        return maximum;
+    }
+
+    uint64_t count() const { return total; }
+    uint64_t maxValue() const { return maximum; }
+
+private:
+    static size_t indexOf(uint64_t value) {
+        if (value < kSubBuckets) return value;
+        int shift = 63 - __builtin_clzll(value) - kSubBucketBits + 1;
+        return kSubBuckets + (shift - 1) * (kSubBuckets / 2) + ((value >> shift) - kSubBuckets / 2);
+    }
+
+    static uint64_t highestIn(size_t index) {
+        if (index < kSubBuckets) return index;
+        size_t k = index - kSubBuckets;
+        int shift = (int)(k / (kSubBuckets / 2)) + 1;
+        uint64_t mantissa = k % (kSubBuckets / 2) + kSubBuckets / 2;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    vector<uint64_t> counts = vector<uint64_t>(kSize);
+    uint64_t total = 0;
+    uint64_t maximum = 0;
+};
+
+struct Options {
+    string target;
+    bool local = false;
+    double rate = 0;
+    size_t connections = 16;
+    double duration = 10;
+    string mix = "/news-feed:6,/health:3,/notifications:1";
+    size_t feeds = 87;
+    string corpus = "bench/corpus";
+
+    // "--name=value" flags and one positional target URL, as listed in the
+    // header comment. Returns false on anything it does not recognize.
+    bool parse(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            string arg = argv[i];
+            size_t eq = arg.find('=');
+            string name = arg.substr(0, eq);
+            string value = eq == string::npos ? "" : arg.substr(eq + 1);
+            if (name == "--local") local = true;
+            else if (name == "--rate") rate = atof(value.c_str());
+            else if (name == "--connections") connections = max<size_t>(1, strtoul(value.c_str(), nullptr, 10));
+            else if (name == "--duration") duration = atof(value.c_str());
+            else if (name == "--mix") mix = value;
+            else if (name == "--feeds") feeds = max<size_t>(1, strtoul(value.c_str(), nullptr, 10));
+            else if (name == "--corpus") corpus = value;
+            else if (arg.rfind("--", 0) != 0 && target.empty()) target = arg;
+            else return false;
+        }
+        return local != !target.empty();
+    }
+};
+
+struct Endpoint {
+    string path;
+    size_t weight;
+};
+
+// "/a:3,/b:1" -> endpoints, and a schedule that interleaves them by weight
+// so any window of requests has roughly the configured mix
+vector<Endpoint> parseMix(const string& mix, vector<size_t>& schedule) {
+    vector<Endpoint> endpoints;
+    stringstream list(mix);
+    string entry;
+    while (getline(list, entry, ',')) {
+        size_t colon = entry.rfind(':');
+        string path = entry.substr(0, colon);
+        size_t weight = colon == string::npos ? 1 : strtoul(entry.c_str() + colon + 1, nullptr, 10);
+        if (!path.empty() && weight > 0) endpoints.push_back({ path, weight });
+    }
+
+    size_t total = 0;
+    for (const auto& endpoint : endpoints) total += endpoint.weight;
+    vector<double> credit(endpoints.size(), 0);
+    for (size_t slot = 0; slot < total; slot++) {
+        size_t best = 0;
+        for (size_t i = 0; i < endpoints.size(); i++) {
+            credit[i] += endpoints[i].weight;
+            if (credit[i] > credit[best]) best = i;
+        }
+        credit[best] -= total;
+        schedule.push_back(best);
+    }
+    return endpoints;
+}
+
+// Per sending thread: one histogram and error count per endpoint
+struct ThreadStats {
+    vector<LatencyHistogram> latencies;
+    vector<size_t> errors;
+    size_t bytes = 0;
+};
+
+ThreadStats runConnection(const Options& options, httplib::Client& client, const vector<Endpoint>& endpoints,
+    const vector<size_t>& schedule, atomic<uint64_t>& nextSlot, chrono::steady_clock::time_point start) {
+    ThreadStats stats;
+    stats.latencies.resize(endpoints.size());
+    stats.errors.resize(endpoints.size());
+
+    auto end = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(options.duration));
+    auto interval = options.rate > 0
+        ? chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(1.0 / options.rate))
+        : chrono::steady_clock::duration::zero();
+
+    while (true) {
+        uint64_t slot = nextSlot.fetch_add(1, memory_order_relaxed);
+        chrono::steady_clock::time_point due = options.rate > 0 ? start + interval * (long)slot : chrono::steady_clock::now();
+        if (due >= end) break;
+        this_thread::sleep_until(due);
+
+        size_t endpoint = schedule[slot % schedule.size()];
+        auto result = client.Get(endpoints[endpoint].path);
+        auto latency = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - due).count();
+
+        stats.latencies[endpoint].record((uint64_t)latency);
+        if (!result || result->status != 200) stats.errors[endpoint]++;
+        else stats.bytes += result->body.size();
+    }
+    return stats;
+}
+
+void printRow(const string& name, const LatencyHistogram& latencies, size_t errors, double seconds) {
+    auto ms = [](uint64_t micros) { return micros / 1000.0; };
+    cout << left << setw(16) << name << right << setw(10) << latencies.count() << setw(8) << errors
+        << fixed << setprecision(1) << setw(10) << latencies.count() / seconds
+        << setprecision(2) << setw(10) << ms(latencies.percentile(0.50)) << setw(10) << ms(latencies.percentile(0.99))
+        << setw(10) << ms(latencies.percentile(0.999)) << setw(10) << ms(latencies.maxValue()) << endl;
+}
+
+// The --local setup: every corpus file served as a feed on loopback, one
+// cold refresh to fill the aggregator, and the API on its own port
+class LocalServer {
+public:
+    explicit LocalServer(const Options& options) {
+        vector<string> bodies;
+        for (const auto& entry : filesystem::directory_iterator(options.corpus)) {
+            if (!entry.is_regular_file() || entry.path().extension() == ".md") continue;
+            ifstream in(entry.path(), ios::binary);
+            stringstream body;
+            body << in.rdbuf();
+            bodies.push_back(body.str());
+        }
+        if (bodies.empty()) throw runtime_error("no feed bodies in " + options.corpus);
+
+        // A server thread per keep-alive connection, or the ones beyond
+        // httplib's default pool of 8 queue until another closes: curl keeps
+        // up to 2 * kMaxTotal idle on top of the transfers in flight, and the
+        // API gets one per sending connection
+        size_t fixtureThreads = FetchScheduler::kMaxTotal * 4;
+        size_t apiThreads = max<size_t>(options.connections, 8);
+        fixtures.new_task_queue = [fixtureThreads]() { return new httplib::ThreadPool(fixtureThreads); };
+        api.new_task_queue = [apiThreads]() { return new httplib::ThreadPool(apiThreads); };
+
+        fixtures.Get(R"(/feed/(\d+))", [bodies](const httplib::Request& req, httplib::Response& res) {
+            size_t feed = strtoul(req.matches[1].str().c_str(), nullptr, 10);
+            res.set_content(bodies[feed % bodies.size()], "application/rss+xml; charset=utf-8");
+            });
+        int fixturePort = fixtures.bind_to_any_port("127.0.0.1");
+        fixtureThread = thread([this]() { fixtures.listen_after_bind(); });
+        fixtures.wait_until_ready();
+
+        vector<Feed> feeds;
+        for (size_t i = 0; i < options.feeds; i++) {
+            feeds.push_back({ "http://127.0.0.1:" + to_string(fixturePort) + "/feed/" + to_string(i),
+                "Fixture " + to_string(i), "General News", "Global" });
+        }
+        aggregator = make_unique<RSSAggregator>(move(feeds));
+        aggregator->refresh();
+
+        registerRoutes(api, *aggregator);
+        port = api.bind_to_any_port("127.0.0.1");
+        apiThread = thread([this]() { api.listen_after_bind(); });
+        api.wait_until_ready();
+    }
+
+    ~LocalServer() {
+        api.stop();
+        apiThread.join();
+        aggregator.reset();
+        fixtures.stop();
+        fixtureThread.join();
+    }
+
+    string url() const {
+        return "http://127.0.0.1:" + to_string(port);
+    }
+
+private:
+    httplib::Server fixtures;
+    thread fixtureThread;
+    unique_ptr<RSSAggregator> aggregator;
+    httplib::Server api;
+    thread apiThread;
+    int port = 0;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!options.parse(argc, argv)) {
+        cerr << "Usage: " << argv[0] << " [options, see load_gen.cpp] <http://host:port | --local>" << endl;
+        return 2;
+    }
+
+    vector<size_t> schedule;
+    vector<Endpoint> endpoints = parseMix(options.mix, schedule);
+    if (endpoints.empty()) {
+        cerr << "Empty endpoint mix: " << options.mix << endl;
+        return 2;
+    }
+
+    unique_ptr<LocalServer> local;
+    if (options.local) {
+        local = make_unique<LocalServer>(options);
+        options.target = local->url();
+    }
+
+    // One request on each connection first, so connection setup stays out
+    // of the measurement
+    vector<unique_ptr<httplib::Client>> clients;
+    for (size_t i = 0; i < options.connections; i++) {
+        clients.push_back(make_unique<httplib::Client>(options.target));
+        clients.back()->set_keep_alive(true);
+        clients.back()->set_read_timeout(60, 0);
+    }
+    {
+        vector<thread> warmups;
+        for (auto& client : clients) {
+            warmups.emplace_back([&client]() { client->Get("/health"); });
+        }
+        for (auto& warmup : warmups) warmup.join();
+    }
+
+    cout << "🔨 " << options.target << ": " << options.connections << " connections, "
+        << (options.rate > 0 ? to_string((long)options.rate) + " req/s open-loop" : string("closed-loop"))
+        << ", " << options.duration << "s, mix " << options.mix << endl;
+
+    atomic<uint64_t> nextSlot{ 0 };
+    vector<ThreadStats> perThread(options.connections);
+    vector<thread> senders;
+    auto start = chrono::steady_clock::now() + chrono::milliseconds(50);
+    for (size_t i = 0; i < options.connections; i++) {
+        senders.emplace_back([&, i]() {
+            perThread[i] = runConnection(options, *clients[i], endpoints, schedule, nextSlot, start);
+            });
+    }
+    for (auto& sender : senders) sender.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << left << setw(16) << "endpoint" << right << setw(10) << "requests" << setw(8) << "errors" << setw(10) << "req/s"
+        << setw(10) << "p50 ms" << setw(10) << "p99 ms" << setw(10) << "p99.9 ms" << setw(10) << "max ms" << endl;
+
+    LatencyHistogram all;
+    size_t allErrors = 0;
+    size_t bytes = 0;
+    for (size_t e = 0; e < endpoints.size(); e++) {
+        LatencyHistogram latencies;
+        size_t errors = 0;
+        for (const auto& stats : perThread) {
+            latencies.merge(stats.latencies[e]);
+            errors += stats.errors[e];
+        }
+        printRow(endpoints[e].path, latencies, errors, seconds);
+        all.merge(latencies);
+        allErrors += errors;
+    }
+    for (const auto& stats : perThread) bytes += stats.bytes;
+    printRow("all", all, allErrors, seconds);
+    cout << "📦 " << fixed << setprecision(1) << bytes / seconds / (1024 * 1024) << " MB/s of response bodies" << endl;
+    return allErrors ? 1 : 0;
+}